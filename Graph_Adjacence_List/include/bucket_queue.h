@@ -6,6 +6,7 @@
 #include <limits>
 #include <iostream>
 #include <memory>
+#include <cstdint>
 #include "pixel.h"
 
 // Bucket Queue otimizada para custos inteiros conforme artigo IFT
@@ -136,6 +137,48 @@ public:
     HybridStats getUsageStats() const;
 };
 
+// === BUCKET QUEUE CIRCULAR ===
+
+// Bucket queue circular sobre índices inteiros (pixels/voxels linearizados).
+// Com custos monótono-incrementais cada novo custo está em [mínimo atual,
+// mínimo + maxIncrement], então maxIncrement + 1 buckets bastam para qualquer
+// faixa total de custos (memória independente do custo máximo). Entradas
+// obsoletas não são removidas: quem chama descarta o elemento retirado se
+// getMinCost() não for mais o custo dele.
+// Cada balde é um vetor com cursor de leitura (FIFO sem alocação por elemento);
+// ao esvaziar, o vetor é limpo mantendo a capacidade para a próxima volta.
+class CircularBucketQueue {
+private:
+    struct Bucket {
+        std::vector<int64_t> items;
+        size_t head = 0;
+
+        bool empty() const { return head == items.size(); }
+    };
+
+    std::vector<Bucket> buckets;    // potência de 2 >= maxIncrement + 1
+    int bucketMask;                 // buckets.size() - 1: índice = custo & máscara
+    int maxIncrement;
+    int currentCost;                // custo do bucket corrente (não circular)
+    size_t totalElements;
+
+public:
+    CircularBucketQueue(int maxIncrement);
+
+    // cost deve estar em [getMinCost(), getMinCost() + maxIncrement]
+    void push(int64_t element, int cost);
+
+    // Remove o elemento FIFO do menor custo; getMinCost() passa a ser o custo dele
+    int64_t pop();
+
+    bool empty() const { return totalElements == 0; }
+    size_t size() const { return totalElements; }
+    int getMinCost() const { return currentCost; }
+    int getMaxIncrement() const { return maxIncrement; }
+
+    void clear();
+};
+
 // === FUNÇÕES AUXILIARES ===
 
 // Factory para criar bucket queue otimizada baseada nas características dos dados
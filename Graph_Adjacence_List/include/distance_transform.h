@@ -0,0 +1,53 @@
+#ifndef DISTANCE_TRANSFORM_H
+#define DISTANCE_TRANSFORM_H
+
+#include <cstdint>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "optimum_path_forest.h"
+
+// Transformada de distância euclidiana (EDT) de um conjunto de sementes.
+// As duas variantes devolvem uma OptimumPathForest no mesmo formato:
+//  - cost: distância euclidiana até a semente mais próxima;
+//  - root: semente mais próxima (o mapa de raízes é a partição de Voronoi);
+//  - label: rótulo dessa semente.
+//
+// IFT: floresta de caminhos ótimos com C(t) = |t - R(s)|², propagando a
+// coordenada da raiz pela vizinhança-8 (Falcão, Stolfi & Lotufo). Predecessores
+// formam caminhos reais até a raiz. Em raras configurações a raiz mais próxima
+// não chega a t por nenhum vizinho; passadas de verificação pelos vizinhos-24,
+// repetidas até estabilizar, corrigem esses pixels (o predecessor passa a ser a
+// própria raiz). Essa correção é heurística, sem prova de exatidão: coincidiu
+// com a força bruta em todos os testes aleatórios, inclusive nos casos em que a
+// vizinhança-8 sozinha erra, mas a variante deve ser tratada como quase exata.
+//
+// Separable: lower envelope de parábolas por coluna e depois por linha
+// (Felzenszwalb & Huttenlocher), O(n) e paralelo por linhas/colunas. Exata por
+// construção; use esta variante quando a exatidão precisa ser garantida. Não há
+// caminho pixel a pixel: predecessor = raiz.
+class DistanceTransform {
+public:
+    enum class Method { IFT, Separable };
+
+    // EDT das sementes ativas (o handicap é ignorado)
+    static OptimumPathForest compute(int width, int height, const SeedSet& seeds,
+                                     Method method = Method::Separable);
+
+    // EDT dos pixels não nulos da máscara; o rótulo é a intensidade do pixel
+    static OptimumPathForest fromMask(const Image& mask, Method method = Method::Separable);
+
+    // Distâncias ao quadrado (inteiras), sem sqrt
+    static std::vector<int64_t> squaredDistances(const OptimumPathForest& forest, int width);
+
+private:
+    struct Root {
+        int index;
+        int label;
+    };
+
+    static OptimumPathForest runIFT(int width, int height, const std::vector<Root>& roots);
+    static OptimumPathForest runSeparable(int width, int height, const std::vector<Root>& roots);
+};
+
+#endif
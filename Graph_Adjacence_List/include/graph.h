@@ -35,8 +35,9 @@ class Graph {
         pair<vector<string>, int> DFS(const string& from, const string& to);
         pair<vector<string>, int> BFS(const string& from, const string& to);
 
-        unordered_map<string, int> getLabeltoIndex();
-        vector<Vertex> getVertices();
+        // Referências para o estado interno (sem cópia); invalidadas por addVertex/removeVertex
+        const unordered_map<string, int>& getLabeltoIndex() const;
+        const vector<Vertex>& getVertices() const;
 
 };
 
@@ -0,0 +1,50 @@
+#ifndef GRAPH_IFT_H
+#define GRAPH_IFT_H
+
+#include <string>
+#include <vector>
+#include "path_cost_function.h"
+#include "optimum_path_forest.h"
+#include "utils/csr_graph.h"
+#include "utils/indexed_heap.h"
+
+// Semente sobre um vértice inteiro (equivalente de Seed para grafos genéricos)
+struct GraphSeed {
+    int vertex;
+    int label;
+    double handicap;    // h(t)
+
+    GraphSeed(int v, int lbl, double h = 0.0) : vertex(v), label(lbl), handicap(h) {}
+};
+
+// IFT sobre qualquer grafo (Graph/DirectedGraph/UndirectedGraph ou CSR) com
+// vértices inteiros. O peso do arco é o peso da aresta no grafo e a função de
+// custo entra apenas por extendCost, então f_sum, f_max etc. funcionam como no
+// IFT de imagens. Todas as sementes competem em uma única propagação
+// (ex.: cada vértice atribuído ao depósito mais próximo em uma só execução).
+class GraphIFT {
+private:
+    CSRGraph graph;
+    OptimumPathForest forest;
+    IndexedMinHeap<double> queue;
+
+public:
+    explicit GraphIFT(const CSRGraph& graph);
+
+    // Snapshot das listas de adjacência (os arcos seguem a direção do grafo)
+    explicit GraphIFT(Graph& graph);
+
+    // Executa a IFT. Sementes repetidas no mesmo vértice: vale o menor handicap
+    // (empate: a primeira). Sementes com handicap infinito não propagam.
+    const OptimumPathForest& run(const PathCostFunction& costFunction,
+                                 const std::vector<GraphSeed>& seeds);
+
+    const OptimumPathForest& getForest() const { return forest; }
+    const CSRGraph& getGraph() const { return graph; }
+
+    // Semente a partir do rótulo textual do vértice
+    static GraphSeed seedAt(Graph& graph, const std::string& vertexLabel, int label,
+                            double handicap = 0.0);
+};
+
+#endif
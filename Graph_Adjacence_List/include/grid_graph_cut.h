@@ -0,0 +1,92 @@
+#ifndef GRID_GRAPH_CUT_H
+#define GRID_GRAPH_CUT_H
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+
+// Corte mínimo (Boykov-Kolmogorov) especializado para grades 4/8-conexas.
+// Sementes com o rótulo do objeto ligam-se à fonte e as demais ao sumidouro,
+// com capacidade K = 1 + soma máxima das arestas de um pixel (restrição rígida).
+// Arestas n-link: B(p,q) = lambda * exp(-(Ip - Iq)^2 / (2 sigma^2)) / dist(p,q),
+// por tabela (sem exp no laço); sigma <= 0 usa a média dos quadrados das
+// diferenças entre vizinhos.
+//
+// Não há lista de arestas: o resíduo do arco p -> p + off[d] fica no vetor da
+// direção d (int16_t), numa grade com moldura de 1 pixel cujos arcos têm
+// capacidade 0, então vizinhos nunca precisam de teste de limite. O pai de cada
+// nó na árvore é só a direção até ele.
+//
+// updateSeeds reaproveita as árvores S/T e o fluxo do corte anterior (como no
+// maxflow v3 de Kolmogorov): muda só os t-links das sementes alteradas,
+// re-enraíza esses nós e retoma o crescimento a partir deles.
+class GridGraphCut {
+public:
+    struct Result {
+        int width, height;
+        std::vector<uint8_t> mask;      // row-major; 1 = objeto (lado da fonte)
+        int64_t flow;                   // fluxo empurrado nesta chamada
+        int64_t cutCost;                // soma das capacidades cortadas
+        size_t augmentations;
+        size_t orphans;
+        double executionTimeMs;
+
+        // Máscara como imagem (255 = objeto)
+        Image toImage() const;
+    };
+
+    explicit GridGraphCut(double lambda = 50.0, double sigma = 0.0, bool eightConnected = true);
+
+    // Constrói o grafo da imagem e calcula o corte do zero
+    Result segment(const Image& image, const SeedSet& seeds, int objectLabel = 1);
+
+    // Novas sementes na mesma imagem, reaproveitando árvores e fluxo
+    Result updateSeeds(const SeedSet& seeds);
+
+    bool hasGraph() const { return width > 0; }
+
+    void setLambda(double value);
+    double getLambda() const { return lambda; }
+
+    void setSigma(double value) { sigma = value; }
+    double getSigma() const { return sigma; }
+
+    void setConnectivity(bool eightConn) { eightConnected = eightConn; }
+    bool getConnectivity() const { return eightConnected; }
+
+private:
+    double lambda;
+    double sigma;
+    bool eightConnected;
+
+    // Estado do último corte (grade com moldura)
+    int width, height, stride, adjacency;
+    int objectLabel;
+    int32_t terminalCapacity;
+    int offsets[8];
+    std::vector<int16_t> residual[8];   // resíduo de p -> p + offsets[d]
+    std::vector<int32_t> terminal;      // > 0: resíduo da fonte; < 0: até o sumidouro
+    std::vector<int8_t> seedSide;       // +1 fonte, -1 sumidouro, 0 livre
+    std::vector<int8_t> tree;           // +1 S, -1 T, 0 livre
+    std::vector<int8_t> parent;         // direção até o pai, TERMINAL ou ORPHAN
+    std::vector<int32_t> timestamp, distance;
+    std::vector<uint8_t> inActive, marked;
+    std::deque<int> active, orphans;
+    int32_t time;
+    size_t augmentations, orphanCount;
+
+    void buildGraph(const Image& image);
+    void assignSeeds(const SeedSet& seeds, std::vector<int8_t>& sides) const;
+    void activate(int v);
+    void makeOrphan(int v, bool front);
+
+    int64_t maxflow();
+    bool grow(int v, int& from, int& to, int& dir);
+    int64_t augment(int from, int to, int dir);
+    void adopt();
+    Result collect(int64_t flow) const;
+};
+
+#endif
@@ -9,6 +9,7 @@
 #include "seed_set.h"
 #include "path_cost_function.h"
 #include "ift_result.h"
+#include "sparse_ift_result.h"
 
 // Comparador para priority queue (fila de prioridade por custo)
 struct PixelCostComparator {
@@ -33,11 +34,12 @@ class IFTAlgorithm {
 protected:
     bool eightConnected;  // Conectividade: 4 ou 8
     bool verbose;         // Debug output
+    int regionHalo;       // Margem extra processada ao redor da ROI
     
 public:
     // Construtor
     IFTAlgorithm(bool eightConn = false, bool verb = false) 
-        : eightConnected(eightConn), verbose(verb) {}
+        : eightConnected(eightConn), verbose(verb), regionHalo(0) {}
     
     // === ALGORITMO PRINCIPAL ===
     
@@ -69,7 +71,20 @@ public:
         const Pixel& target
     );
     
-    // Versão que processa apenas região de interesse (ROI)
+    // Versão limitada por custo: para quando o menor custo da fila excede maxCost.
+    // Memória e tempo proporcionais à região alcançada (resultado paginado)
+    std::unique_ptr<SparseIFTResult> runIFTBounded(
+        const Image& image,
+        const PathCostFunction& costFunction,
+        const SeedSet& seeds,
+        double maxCost
+    );
+    
+    // Versão que processa apenas região de interesse (ROI).
+    // Buffers e fila são dimensionados à ROI mais o halo (ver setRegionHalo):
+    // caminhos podem atravessar o halo, mas só os pixels da ROI vão para o
+    // resultado, em coordenadas da imagem. Predecessores podem cair no halo;
+    // IFTResult::stitchRegion monta a imagem inteira a partir de várias ROIs.
     std::unique_ptr<IFTResult> runIFTInRegion(
         const Image& image,
         const PathCostFunction& costFunction,
@@ -82,6 +97,11 @@ public:
     void setConnectivity(bool eightConn) { eightConnected = eightConn; }
     bool getConnectivity() const { return eightConnected; }
     
+    // Halo de runIFTInRegion em pixels (0 = grafo restrito à ROI). Com halo
+    // suficiente os custos na borda da ROI coincidem com os da imagem inteira
+    void setRegionHalo(int halo);
+    int getRegionHalo() const { return regionHalo; }
+    
     void setVerbose(bool verb) { verbose = verb; }
     bool getVerbose() const { return verbose; }
     
@@ -112,6 +112,10 @@ public:
     // Marca pixel como semente processada
     void addSeedPixel(const Pixel& pixel) { seedPixels.push_back(pixel); }
     
+    // Copia os pixels de um resultado parcial (ex.: runIFTInRegion) para este,
+    // sobrescrevendo (P, C, L) desses pixels. Dimensões devem coincidir
+    void stitchRegion(const IFTResult& region);
+    
     // Dimensões
     int getWidth() const { return width; }
     int getHeight() const { return height; }
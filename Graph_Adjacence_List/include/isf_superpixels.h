@@ -0,0 +1,71 @@
+#ifndef ISF_SUPERPIXELS_H
+#define ISF_SUPERPIXELS_H
+
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "path_cost_function.h"
+#include "optimum_path_forest.h"
+#include "utils/indexed_heap.h"
+
+// Superpixels por Iterative Spanning Forest (ISF): sementes em grade, IFT com
+// f_sum, recálculo das sementes pelos centróides das árvores e repetição.
+// Pesos de arco são calculados uma vez por imagem e guardados em cache; floresta
+// e fila são buffers planos reutilizados entre iterações. Da segunda iteração em
+// diante só as árvores cujas sementes mudaram são reconquistadas (IFT diferencial).
+class ISFSuperpixels {
+private:
+    int width, height;
+    std::vector<uint8_t> intensity;     // cópia row-major da imagem
+    bool eightConnected;
+    double alpha;                       // peso da diferença de intensidade
+    double beta;                        // expoente da diferença de intensidade
+
+    std::vector<int> offsetX, offsetY;  // deslocamentos da adjacência
+    std::vector<double> arcWeights;     // cache: arcWeights[v * K + d] (+∞ fora da imagem)
+    OptimumPathForest forest;
+    IndexedMinHeap<double> queue;
+    std::vector<int> seedVertices;      // semente da árvore de rótulo i + 1
+
+    // Estatísticas por iteração
+    std::vector<int> movedSeedsPerIteration;
+    std::vector<size_t> conqueredPerIteration;
+
+    void buildArcWeights(const Image& image, const PathCostFunction& costFunction);
+    std::vector<int> gridSeeds(int superpixelCount) const;
+
+    // Novas sementes: pixel de cada árvore mais próximo do centróide da árvore
+    std::vector<int> recomputeSeeds() const;
+
+    // Remove as árvores das sementes movidas e recoloca a fronteira na fila
+    void releaseTrees(const std::vector<char>& movedLabel);
+
+    void pushSeed(int tree);
+
+    // Loop da IFT diferencial: também atualiza t quando P(t) = s, mantendo as
+    // subárvores consistentes após a remoção de árvores
+    size_t conquer();
+
+public:
+    // costFunction fornece w(s,t) para o cache: w' = (alpha * w)^beta + ||s - t||
+    ISFSuperpixels(const Image& image, const PathCostFunction& costFunction,
+                   bool eightConnected = false, double alpha = 0.5, double beta = 12.0);
+
+    // Gera cerca de superpixelCount superpixels; para antes de `iterations` se
+    // nenhuma semente mudar. Rótulos das árvores = 1..k
+    const OptimumPathForest& run(int superpixelCount, int iterations = 10);
+
+    const OptimumPathForest& getForest() const { return forest; }
+
+    // Rótulo de cada pixel (row-major)
+    const std::vector<int>& getLabels() const { return forest.label; }
+
+    // Sementes finais (label = rótulo da árvore)
+    SeedSet getSeeds() const;
+
+    int getSuperpixelCount() const { return static_cast<int>(seedVertices.size()); }
+    const std::vector<int>& getMovedSeedsPerIteration() const { return movedSeedsPerIteration; }
+    const std::vector<size_t>& getConqueredPerIteration() const { return conqueredPerIteration; }
+};
+
+#endif
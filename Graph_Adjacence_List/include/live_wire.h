@@ -0,0 +1,85 @@
+#ifndef LIVE_WIRE_H
+#define LIVE_WIRE_H
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "image.h"
+#include "pixel.h"
+
+// Live-wire (intelligent scissors) para traçado interativo de contornos.
+// Custo local por pixel: 1 + (255 - gradiente de Sobel normalizado), de modo que
+// caminhos de custo mínimo (soma) seguem bordas fortes. Arcos diagonais custam
+// o custo local do destino vezes √2.
+//
+// Cada âncora tem sua própria floresta, criada só na primeira consulta e
+// expandida sob demanda: a busca é A* em direção ao cursor com heurística
+// octil (consistente, pois todo arco custa pelo menos seu comprimento), então
+// pixels fechados têm custo ótimo independentemente do alvo. Ao mover o cursor
+// a fila aberta é re-chaveada para o novo alvo e nada é refeito; se o cursor cai
+// em pixel já fechado, o caminho sai direto dos predecessores.
+//
+// As florestas são paginadas em blocos de 64x64 alocados ao serem alcançados
+// (memória proporcional à área explorada) e mantidas em cache LRU de âncoras.
+// A imagem é referenciada e precisa viver tanto quanto o LiveWire.
+class LiveWire {
+public:
+    struct QueryStats {
+        bool cachedForest;          // floresta da âncora já existia
+        bool rekeyed;               // fila aberta re-chaveada para novo cursor
+        size_t expandedPixels;      // pixels fechados nesta consulta
+        size_t pathLength;
+        double pathCost;
+        double executionTimeMs;
+
+        void print() const;
+    };
+
+    LiveWire(const Image& image, bool eightConnected = true, size_t cacheCapacity = 4);
+    ~LiveWire();
+
+    // Caminho ótimo da âncora ao cursor (âncora primeiro)
+    std::vector<Pixel> getPath(const Pixel& anchor, const Pixel& cursor);
+
+    // Custo do caminho ótimo da âncora ao cursor
+    double getPathCost(const Pixel& anchor, const Pixel& cursor);
+
+    // Cache de florestas por âncora (LRU)
+    void setCacheCapacity(size_t capacity);
+    size_t getCacheCapacity() const { return cacheCapacity; }
+    size_t getCachedAnchorCount() const { return forests.size(); }
+    void clearCache();
+
+    // Custo local do pixel (1..256)
+    double getLocalCost(int x, int y) const;
+
+    QueryStats getLastQueryStats() const { return lastStats; }
+
+private:
+    struct AnchorForest;
+
+    const Image& image;
+    bool eightConnected;
+    size_t cacheCapacity;
+    int width, height;
+    int tilesX;
+    std::vector<uint8_t> localCost;     // 255 - gradiente normalizado
+
+    std::list<std::unique_ptr<AnchorForest>> forests;   // mais recente primeiro
+    std::unordered_map<int, std::list<std::unique_ptr<AnchorForest>>::iterator> forestIndex;
+
+    QueryStats lastStats;
+
+    void computeLocalCost();
+    int indexOf(const Pixel& pixel) const;
+    double heuristic(int x, int y, int goalX, int goalY) const;
+
+    AnchorForest& forestFor(int anchor);
+
+    // Expande a floresta até fechar o alvo; retorna seu custo
+    double expandTo(AnchorForest& forest, int goal);
+};
+
+#endif
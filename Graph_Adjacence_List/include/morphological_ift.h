@@ -0,0 +1,62 @@
+#ifndef MORPHOLOGICAL_IFT_H
+#define MORPHOLOGICAL_IFT_H
+
+#include <cstdint>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+
+// Reconstrução morfológica e mínimos regionais como IFT com fila hierárquica
+// (um balde FIFO por nível de cinza), sobre imagens uint8_t ou uint16_t em
+// vetores contíguos (y * width + x).
+//
+// Reconstrução superior (por dilatação) de marker sob mask (marker <= mask):
+//   R(t) = max sobre caminhos π até t de min(marker(raiz), min de mask em π).
+// É uma IFT com handicap min(marker, mask) e custo f(π·⟨s,t⟩) = min(f(π), mask(t))
+// maximizado: o primeiro pixel retirado do nível mais alto já é definitivo.
+// A reconstrução inferior (por erosão, marker >= mask) é a dual.
+//
+// Mínimos regionais: reconstrução inferior de f a partir de f + 1. Pixels com
+// R(t) > f(t) pertencem a mínimos, e cada platô mínimo é rotulado no mesmo passe
+// quando seu primeiro pixel sai da fila.
+template <typename T>
+class MorphologicalIFT {
+private:
+    int width, height;
+    bool eightConnected;
+
+public:
+    MorphologicalIFT(int width, int height, bool eightConnected = true);
+
+    // Reconstrução por dilatação (marker <= mask em todo pixel)
+    std::vector<T> reconstructByDilation(const std::vector<T>& marker, const std::vector<T>& mask) const;
+
+    // Reconstrução por erosão (marker >= mask em todo pixel)
+    std::vector<T> reconstructByErosion(const std::vector<T>& marker, const std::vector<T>& mask) const;
+
+    // Rotula mínimos regionais com 1..k (0 fora deles); retorna k
+    int regionalMinima(const std::vector<T>& image, std::vector<int>& labels) const;
+
+    // Rotula máximos regionais com 1..k (0 fora deles); retorna k
+    int regionalMaxima(const std::vector<T>& image, std::vector<int>& labels) const;
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+
+private:
+    // Passe da fila hierárquica sobre valores inteiros em [0, levels).
+    // descending: retira o nível mais alto primeiro e propaga min (dilatação);
+    // senão retira o mais baixo e propaga max (erosão). Se plateau não é nulo,
+    // rotula em `labels` os platôs de `plateau` cujos pixels terminam com
+    // R(t) != plateau(t) (mínimos/máximos regionais) e retorna quantos são
+    int propagate(std::vector<int32_t>& values, const std::vector<T>& mask, int levels, bool descending,
+                  const std::vector<T>* plateau = nullptr, std::vector<int>* labels = nullptr) const;
+
+    void checkSize(const std::vector<T>& values) const;
+};
+
+// Mínimos regionais da imagem como sementes prontas para o watershed
+// (createWatershedMax): um rótulo por mínimo, handicap = intensidade do mínimo
+SeedSet regionalMinimaSeeds(const Image& image, bool eightConnected = true);
+
+#endif
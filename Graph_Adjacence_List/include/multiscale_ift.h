@@ -0,0 +1,73 @@
+#ifndef MULTISCALE_IFT_H
+#define MULTISCALE_IFT_H
+
+#include <memory>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "path_cost_function.h"
+#include "ift_result.h"
+#include "utils/indexed_heap.h"
+
+// IFT coarse-to-fine: pirâmide por média 2x2, IFT completa no nível mais grosso
+// (sementes mapeadas para baixo) e, em cada nível mais fino, nova IFT apenas em
+// uma faixa em torno das fronteiras entre rótulos. Fora da faixa o rótulo e o
+// custo vêm do nível anterior ampliado; os pixels fixos vizinhos da faixa entram
+// na fila como raízes com o custo ampliado, então a faixa é disputada como em uma
+// IFT comum. A vizinhança de cada semente também entra sempre na faixa. A
+// resolução cheia só é processada perto das bordas dos objetos.
+//
+// O produto do método são os rótulos. Os custos são aproximados: fora da faixa
+// final o custo é o do nível em que o pixel foi fixado (ampliado, na escala
+// daquele nível: para f_sum, caminhos com cerca de metade dos passos sobre a
+// imagem reduzida), e na faixa é o custo no nível fino somado a essas raízes.
+// Só com maxLevels = 1 os custos são os de uma IFT de resolução cheia.
+class MultiscaleIFT {
+private:
+    int maxLevels;          // número máximo de níveis (1 = IFT de resolução cheia)
+    int minLevelSize;       // menor lado aceito para um nível da pirâmide
+    int bandRadius;         // raio da faixa (4-adjacência) em pixels do nível
+    bool eightConnected;
+
+public:
+    MultiscaleIFT(int maxLevels = 4, int bandRadius = 2, bool eightConnected = false,
+                  int minLevelSize = 32)
+        : maxLevels(maxLevels), minLevelSize(minLevelSize), bandRadius(bandRadius),
+          eightConnected(eightConnected) {}
+
+    struct LevelStats {
+        int width, height;
+        size_t processedPixels;     // pixels conquistados pela IFT deste nível
+
+        void print() const;
+    };
+
+    struct Result {
+        int width, height;
+        std::vector<int> labels;        // row-major; -1 se não conquistado
+        std::vector<double> costs;      // row-major; aproximados (ver acima)
+        std::vector<LevelStats> levels; // do mais grosso ao mais fino
+
+        // Resultado compatível com IFTResult (C e L; P fica vazio)
+        std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+    };
+
+    Result run(const Image& image, const PathCostFunction& costFunction, const SeedSet& seeds) const;
+
+    void setBandRadius(int radius) { bandRadius = radius; }
+    int getBandRadius() const { return bandRadius; }
+
+    void setMaxLevels(int levels) { maxLevels = levels; }
+    int getMaxLevels() const { return maxLevels; }
+
+private:
+    // IFT restrita aos pixels com free[v] != 0; os já presentes na fila são raízes
+    size_t propagate(const Image& image, const PathCostFunction& costFunction,
+                     const std::vector<char>& free, std::vector<double>& costs,
+                     std::vector<int>& labels, IndexedMinHeap<double>& queue) const;
+
+    // Marca os pixels a até bandRadius passos de uma fronteira entre rótulos
+    std::vector<char> boundaryBand(int width, int height, const std::vector<int>& labels) const;
+};
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef OPF_CLASSIFIER_H
+#define OPF_CLASSIFIER_H
+
+#include <cstddef>
+#include <vector>
+#include "optimum_path_forest.h"
+
+// Classificador supervisionado por floresta de caminhos ótimos (OPF, Papa et al.):
+// a IFT do projeto sobre o grafo completo das amostras de treino, com f_max e
+// distância euclidiana entre vetores de características.
+//
+// Treino: protótipos são as amostras ligadas por arestas de rótulos distintos na
+// árvore geradora mínima (Prim no grafo completo implícito, O(n^2) distâncias:
+// cada passo atualiza as chaves e acha o próximo vértice numa única passada
+// paralela, numa equipe de threads criada uma vez por treino). Depois, IFT com f_max a partir dos protótipos, no mesmo esquema.
+// A IFT conquista as amostras em ordem crescente de custo, e é nessa ordem que
+// elas ficam guardadas (características contíguas).
+//
+// Classificação: custo de s = min sobre t de max(C(t), d(s, t)). Como
+// max(C(t), d) >= C(t), a varredura na ordem de custo para quando C(t) alcança o
+// melhor custo já encontrado. As amostras de treino ficam em blocos de 8 com as
+// características transpostas, então as 8 distâncias de um bloco saem de
+// operações SIMD independentemente da dimensão. Lotes são divididos entre threads.
+//
+// Internamente as distâncias são ao quadrado (f_max preserva a ordem); os
+// custos expostos na floresta de treino são euclidianos.
+class OPFClassifier {
+public:
+    struct ClassifyStats {
+        size_t samples;
+        double averageVisited;      // amostras de treino examinadas por consulta
+        double executionTimeMs;
+
+        void print() const;
+    };
+
+    explicit OPFClassifier(unsigned threads = 0)
+        : dimensions(0), threads(threads), trainingSize(0), lastStats() {}
+
+    // features: amostras em linhas (n x dimensions, row-major)
+    void train(const std::vector<float>& features, size_t dimensions, const std::vector<int>& labels);
+
+    // Rótulo de uma amostra com getDimensions() valores (atualiza as estatísticas
+    // como um lote de uma amostra)
+    int classify(const float* sample) const;
+
+    // Rótulos de um lote (n x getDimensions(), row-major)
+    std::vector<int> classify(const std::vector<float>& features) const;
+
+    bool isTrained() const { return trainingSize > 0; }
+    size_t getDimensions() const { return dimensions; }
+    size_t getTrainingSize() const { return trainingSize; }
+
+    // Índices originais dos protótipos, crescentes
+    const std::vector<int>& getPrototypes() const { return prototypes; }
+
+    // Floresta de treino indexada pela ordem original das amostras
+    const OptimumPathForest& getTrainingForest() const { return forest; }
+
+    void setThreads(unsigned value) { threads = value; }
+    unsigned getThreads() const { return threads; }
+
+    ClassifyStats getLastClassifyStats() const { return lastStats; }
+
+private:
+    static constexpr size_t BLOCK = 8;
+
+    size_t dimensions;
+    unsigned threads;
+    size_t trainingSize;
+
+    // Amostras de treino em ordem crescente de custo, em blocos de BLOCK:
+    // característica d da amostra j do bloco b em [(b * dimensions + d) * BLOCK + j]
+    std::vector<float> orderedFeatures;
+    std::vector<float> orderedCost;     // distância ao quadrado; +∞ no enchimento
+    std::vector<int> orderedLabel;
+
+    std::vector<int> prototypes;
+    OptimumPathForest forest;
+    mutable ClassifyStats lastStats;
+
+    // Protótipos pela MST; retorna os índices em ordem crescente
+    std::vector<int> findPrototypes(const std::vector<float>& features, const std::vector<int>& labels) const;
+
+    // Melhor rótulo para a amostra; soma em visited as amostras examinadas
+    int classifyOne(const float* sample, size_t& visited) const;
+};
+
+#endif
@@ -0,0 +1,33 @@
+#ifndef OPTIMUM_PATH_FOREST_H
+#define OPTIMUM_PATH_FOREST_H
+
+#include <limits>
+#include <memory>
+#include <vector>
+#include "image.h"
+#include "ift_result.h"
+
+// Floresta de caminhos ótimos (P, C, L) indexada por vértice inteiro, em vetores
+// planos. Para imagens, vértice = y * width + x. Serve de saída comum aos motores
+// que não trabalham com Pixel (grafos genéricos, regiões, transformadas).
+struct OptimumPathForest {
+    std::vector<double> cost;       // C(t); +∞ se t não foi conquistado
+    std::vector<int> predecessor;   // P(t); -1 em raízes e não conquistados
+    std::vector<int> root;          // R(t); -1 se t não foi conquistado
+    std::vector<int> label;         // L(t); -1 se t não foi conquistado
+
+    // Redimensiona e volta ao estado inicial (nenhum vértice conquistado)
+    void reset(int vertexCount);
+
+    int size() const { return static_cast<int>(cost.size()); }
+    bool isConquered(int v) const { return root[v] != -1; }
+    bool isRoot(int v) const { return root[v] == v; }
+
+    // Caminho ótimo da raiz até v (vazio se v não foi conquistado)
+    std::vector<int> path(int v) const;
+
+    // Converte para IFTResult tratando o vértice i como o pixel i da imagem (row-major)
+    std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef RANDOM_WALKER_H
+#define RANDOM_WALKER_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "ift_result.h"
+#include "path_cost_function.h"
+
+// Segmentação random walker (Grady) em grade 4-conexa.
+// Condutância de cada aresta: exp(-beta * (d / dmax)^2) + 1e-6, onde d é o peso
+// da ArcWeightStrategy (amostrado numa tabela 256x256, como no VolumeIFT) e dmax
+// o maior d da tabela; o termo 1e-6 mantém o grafo conexo.
+//
+// Para K rótulos resolve L_U X = -B M para K - 1 colunas de uma vez (a última
+// probabilidade é 1 - soma das demais) com gradiente conjugado pré-condicionado
+// por Jacobi, sem montar a matriz: o Laplaciano sai das condutâncias leste/sul
+// de cada pixel. As colunas ficam intercaladas por pixel (x[v * C + k]), então
+// uma passada lê os vizinhos de cada pixel uma vez para todas as colunas (laço de
+// rótulos desenrolado para até 4 colunas); cada coluna tem seus próprios escalares
+// de CG. Passadas são paralelas por linhas numa equipe de threads criada uma vez
+// por solve, com somas parciais por bloco combinadas em ordem (determinístico).
+// Condutâncias em float; vetores do CG em double (em float o piso de
+// arredondamento de ||r|| já passa de 1e-3 em imagens de alguns megapixels).
+
+class RandomWalker {
+public:
+    struct Result {
+        int width, height;
+        std::vector<int> labels;            // row-major; rótulo mais provável
+        std::vector<float> probabilities;   // [v * K + k], k na ordem de labelValues
+        std::vector<int> labelValues;       // rótulos das sementes, crescentes
+        int iterations;
+        double relativeResidual;            // pior coluna, ||r|| / ||b||
+        double executionTimeMs;
+
+        float getProbability(int x, int y, int k) const {
+            return probabilities[(static_cast<size_t>(y) * width + x) * labelValues.size() + k];
+        }
+
+        // C = 1 - probabilidade do rótulo escolhido, L = rótulo
+        std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+    };
+
+    explicit RandomWalker(double beta = 90.0, int maxIterations = 2000, double tolerance = 1e-4);
+    RandomWalker(std::unique_ptr<ArcWeightStrategy> strategy, double beta = 90.0,
+                 int maxIterations = 2000, double tolerance = 1e-4);
+
+    Result run(const Image& image, const SeedSet& seeds) const;
+
+    void setBeta(double value);
+    double getBeta() const { return beta; }
+
+    void setMaxIterations(int value);
+    int getMaxIterations() const { return maxIterations; }
+
+    void setTolerance(double value);
+    double getTolerance() const { return tolerance; }
+
+    void setThreads(unsigned value) { threads = value; }
+    unsigned getThreads() const { return threads; }
+
+private:
+    struct Grid;
+
+    std::unique_ptr<ArcWeightStrategy> strategy;
+    double beta;
+    int maxIterations;
+    double tolerance;
+    unsigned threads;
+
+    // Condutâncias por par de intensidades em [a * 256 + b]
+    std::vector<float> conductanceTable(const Image& image) const;
+
+    // CG a partir de x = 0 (intercalado, 0 nas sementes); retorna as iterações
+    int solve(const Grid& grid, int columns, std::vector<double>& x, double& residual) const;
+
+    template <int C>
+    int solveColumns(const Grid& grid, int columns, std::vector<double>& x, double& residual) const;
+};
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef REGION_IFT_H
+#define REGION_IFT_H
+
+#include <memory>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "path_cost_function.h"
+#include "ift_result.h"
+#include "graph_ift.h"
+#include "utils/region_adjacency_graph.h"
+
+// IFT sobre o grafo de adjacência de regiões (superpixels) em vez de pixels.
+// Nós = regiões de uma pré-segmentação, arcos = regiões adjacentes com peso
+// igual ao contraste médio da fronteira (RegionAdjacencyGraph). Sementes são
+// mapeadas para a região que as contém e os rótulos são projetados de volta aos
+// pixels. Os buffers da floresta são reaproveitados entre execuções, então cada
+// edição de sementes custa uma IFT sobre milhares de nós, não milhões de pixels.
+class RegionIFT {
+private:
+    int width, height;
+    std::vector<int> pixelRegion;       // região de cada pixel (row-major)
+    GraphIFT engine;                    // IFT sobre o CSR das regiões
+    std::vector<GraphSeed> regionSeeds;
+
+public:
+    // labels = rótulos densos por pixel usados para construir rag
+    RegionIFT(const RegionAdjacencyGraph& rag, const std::vector<int>& labels, int width, int height);
+
+    // Executa a IFT: handicap h(t) vem de costFunction e arcos usam extendCost
+    // sobre o contraste entre regiões. Se várias sementes caem na mesma região,
+    // prevalece a de menor handicap (empate: a primeira do SeedSet).
+    void run(const PathCostFunction& costFunction, const SeedSet& seeds);
+
+    // === CONSULTAS POR REGIÃO ===
+
+    int getRegionCount() const { return engine.getGraph().getVertexCount(); }
+    int regionOf(int x, int y) const { return pixelRegion[static_cast<size_t>(y) * width + x]; }
+    double getRegionCost(int region) const { return engine.getForest().cost[region]; }
+    int getRegionPredecessor(int region) const { return engine.getForest().predecessor[region]; }
+    int getRegionLabel(int region) const { return engine.getForest().label[region]; }
+    const OptimumPathForest& getRegionForest() const { return engine.getForest(); }
+    const CSRGraph& getGraph() const { return engine.getGraph(); }
+
+    // === PROJEÇÃO PARA PIXELS ===
+
+    // Rótulo de cada pixel (row-major, -1 se a região não foi conquistada)
+    std::vector<int> projectLabels() const;
+
+    // Custo de cada pixel (row-major) = custo da sua região
+    std::vector<double> projectCosts() const;
+
+    // Resultado compatível com IFTResult preenchendo C e L de todos os pixels
+    // (P fica vazio: a floresta é entre regiões, não entre pixels)
+    std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+};
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef SPARSE_IFT_RESULT_H
+#define SPARSE_IFT_RESULT_H
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "pixel.h"
+#include "image.h"
+#include "ift_result.h"
+
+// Resultado esparso da IFT: (P, C, L) em páginas de 64x64 pixels alocadas só
+// quando algum pixel da página é alcançado, mais a lista dos pixels conquistados
+// na ordem de conquista. Memória proporcional à região alcançada, não à imagem
+// (o diretório de páginas custa um ponteiro por 4096 pixels).
+class SparseIFTResult {
+public:
+    static constexpr int TILE_BITS = 6;
+    static constexpr int TILE_SIZE = 1 << TILE_BITS;
+    static constexpr int TILE_AREA = TILE_SIZE * TILE_SIZE;
+
+private:
+    struct Tile {
+        std::array<double, TILE_AREA> cost;
+        std::array<int32_t, TILE_AREA> predecessor;     // índice linear ou -1
+        std::array<int32_t, TILE_AREA> label;
+        std::array<uint8_t, TILE_AREA> conquered;
+
+        Tile();
+    };
+
+    int width, height;
+    int tilesX, tilesY;
+    double maxCost;
+    std::vector<std::unique_ptr<Tile>> tiles;
+    std::vector<Pixel> conqueredPixels;
+    size_t allocatedTiles;
+
+    Tile* findTile(int x, int y) const {
+        return tiles[(y >> TILE_BITS) * tilesX + (x >> TILE_BITS)].get();
+    }
+    static int offsetInTile(int x, int y) {
+        return ((y & (TILE_SIZE - 1)) << TILE_BITS) | (x & (TILE_SIZE - 1));
+    }
+
+public:
+    SparseIFTResult(int width, int height, double maxCost);
+
+    // === ACESSO (pixels fora da região conquistada: custo +∞, rótulo -1) ===
+
+    double getCost(int x, int y) const;
+    int getLabel(int x, int y) const;
+    bool isConquered(int x, int y) const;
+    bool hasPredecessor(int x, int y) const;
+    Pixel getPredecessor(int x, int y) const;   // coordenadas (intensidade 0)
+
+    // Pixels conquistados (custo <= maxCost) na ordem de conquista
+    const std::vector<Pixel>& getConqueredPixels() const { return conqueredPixels; }
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    double getMaxCost() const { return maxCost; }
+
+    size_t getAllocatedTileCount() const { return allocatedTiles; }
+    size_t memoryBytes() const;
+
+    // Converte apenas os pixels conquistados para IFTResult (image fornece as
+    // intensidades dos predecessores, que fazem parte da chave de Pixel)
+    std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+
+    // === USO INTERNO DOS ALGORITMOS ===
+
+    // Custo corrente (provisório ou final); +∞ se nunca alcançado
+    double getTentativeCost(int x, int y) const;
+
+    // Custo provisório (não conquistado) ou final; aloca a página se preciso
+    void update(int x, int y, double cost, int predecessorIndex, int label);
+    void markConquered(const Pixel& pixel);
+};
+
+#endif
@@ -3,11 +3,21 @@
 #define GRAPH_INTERNAL_ACCESS
 
 #include "Graph.h"
+#include <tuple>
 
 class UndirectedGraph : public Graph {
 public:
     void addEdge(const std::string& from, const std::string& to, double weight = 1.0);
     void removeEdge(const string& from, const string& to);
+
+    // Lista canônica de arestas (peso, u, v) com u < v, na ordem da lista de adjacência.
+    // Os índices de aresta usados por minimumSpanningForest referem-se a esta lista.
+    vector<tuple<double, int, int>> getEdgeList() const;
+
+    // Floresta geradora mínima (Borůvka paralelo). Retorna os índices das arestas
+    // da floresta em getEdgeList(), em ordem crescente. Empates de peso são
+    // desfeitos pelo índice, então o resultado é único e determinístico.
+    vector<int> minimumSpanningForest(unsigned threads = 0) const;
 };
 
 #endif
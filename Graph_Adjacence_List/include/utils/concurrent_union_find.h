@@ -0,0 +1,70 @@
+#ifndef CONCURRENT_UNION_FIND_H
+#define CONCURRENT_UNION_FIND_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+// Union-find concorrente para uniões em paralelo (segmentação paralela,
+// rotulação de componentes, Borůvka).
+// Cada nó é uma palavra atômica de 64 bits:
+//   - nó interno: índice do pai (bit 63 = 0)
+//   - raiz: bit 63 = 1, bit 62 = em fusão, tamanho nos 32 bits baixos
+// internalDiff fica num double à parte (o mesmo valor exato do UnionFind), só
+// gravado por quem detém a marca de fusão da raiz e lido em snapshot validado
+// pela palavra (palavra, diff, palavra de novo).
+//
+// Não é lock-free: a marca de fusão é uma trava curta por raiz. Uma ligação
+// marca por CAS a raiz sobrevivente (menor índice) a partir exatamente da
+// palavra que o predicado leu, liga por CAS a raiz absorvida (maior índice),
+// também a partir da palavra lida, grava diff e tamanho somados e desfaz a
+// marca. Se qualquer CAS falhar, a operação recomeça com dados novos. Quem
+// precisa da palavra de uma raiz marcada (unite, join, getSize,
+// getInternalDiff) espera com yield, então uma thread desescalonada no meio de
+// uma ligação atrasa as demais que tocam o mesmo conjunto. find e sameSet não
+// esperam: path splitting nunca toca em raízes.
+// Cada unite/join bem-sucedido é linearizado na CAS da raiz absorvida, com as
+// duas raízes ainda iguais ao que foi lido: o estado final é o de uma execução
+// sequencial das mesmas operações nessa ordem.
+class ConcurrentUnionFind {
+
+private:
+    std::vector<std::atomic<uint64_t>> words;
+
+    static constexpr uint64_t ROOT_FLAG = uint64_t(1) << 63;
+    static constexpr uint64_t MERGING_FLAG = uint64_t(1) << 62;
+
+    static bool isRoot(uint64_t word) { return (word & ROOT_FLAG) != 0; }
+    static bool isMerging(uint64_t word) { return (word & MERGING_FLAG) != 0; }
+    static int parentOf(uint64_t word) { return static_cast<int>(word & 0xFFFFFFFFu); }
+    static uint32_t sizeOf(uint64_t word) { return static_cast<uint32_t>(word & 0xFFFFFFFFu); }
+    static uint64_t makeRoot(uint32_t size) { return ROOT_FLAG | size; }
+    static uint64_t makeParent(int parent) { return static_cast<uint32_t>(parent); }
+
+    std::vector<std::atomic<double>> diffs;     // internalDiff de cada raiz
+
+    // Liga a raiz hi sob lo; false se alguma das duas mudou desde hiWord/loWord
+    bool link(int hi, uint64_t hiWord, int lo, uint64_t loWord, double mergedDiff);
+
+    // Palavra e diff da raiz do conjunto de u, fora de fusão (espera se preciso)
+    uint64_t rootWord(int u, int& root, double& diff);
+
+public:
+    ConcurrentUnionFind(int n);
+
+    // Todos os métodos abaixo podem ser chamados concorrentemente
+    int find(int u);
+    bool sameSet(int u, int v);
+
+    // União incondicional; true se esta chamada uniu dois conjuntos distintos
+    bool unite(int u, int v);
+
+    // União com o predicado de Felzenszwalb (diferença interna + k/tamanho)
+    bool join(int u, int v, double weight, double k);
+
+    int getSize(int u);
+    double getInternalDiff(int u);
+    int elementCount() const { return static_cast<int>(words.size()); }
+};
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef CSR_GRAPH_H
+#define CSR_GRAPH_H
+
+#include "undirected_Graph.h"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+// Grafo em formato CSR (compressed sparse row): os arcos de u ocupam
+// [offsets[u], offsets[u + 1]) em targets/weights. Em listas de arestas não
+// direcionadas cada aresta gera dois arcos; edgeIds liga o arco à posição da
+// aresta na lista de origem, para que atributos extras por aresta fiquem fora da
+// estrutura.
+class CSRGraph {
+private:
+    std::vector<int> offsets;
+    std::vector<int> targets;
+    std::vector<double> weights;
+    std::vector<int> edgeIds;
+
+public:
+    CSRGraph() : offsets(1, 0) {}
+
+    // Arestas (peso, u, v); os arcos de cada vértice mantêm a ordem da lista
+    static CSRGraph fromEdgeList(int vertexCount, const std::vector<std::tuple<double, int, int>>& edges);
+
+    // Mesmos índices de vértice de graph, inclusive os removidos (ficam sem arcos);
+    // edgeIds referem-se a graph.getEdgeList()
+    static CSRGraph fromGraph(UndirectedGraph& graph);
+
+    // Snapshot das listas de adjacência de qualquer Graph (dirigido ou não), com os
+    // mesmos índices de vértice; vértices removidos ficam sem arcos. edgeId = índice do arco
+    static CSRGraph fromAdjacency(Graph& graph);
+
+    // Adiciona ao grafo um vértice por índice (rótulo = to_string(i)) e as arestas
+    void toUndirectedGraph(UndirectedGraph& graph) const;
+
+    int getVertexCount() const { return static_cast<int>(offsets.size()) - 1; }
+    size_t getArcCount() const { return targets.size(); }
+    int degree(int u) const { return offsets[u + 1] - offsets[u]; }
+
+    int arcBegin(int u) const { return offsets[u]; }
+    int arcEnd(int u) const { return offsets[u + 1]; }
+    int arcTarget(int arc) const { return targets[arc]; }
+    double arcWeight(int arc) const { return weights[arc]; }
+    int arcEdge(int arc) const { return edgeIds[arc]; }
+
+    const std::vector<int>& getOffsets() const { return offsets; }
+    const std::vector<int>& getTargets() const { return targets; }
+    const std::vector<double>& getWeights() const { return weights; }
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef EDGE_SORT_H
+#define EDGE_SORT_H
+
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+// Ordenação de arestas (peso, u, v) por peso.
+// Pesos gerados por ImageGraphConverter são inteiros (grayDistance) ou raízes
+// quadradas de inteiros (rgbDistance); nesses casos a ordenação é feita por radix
+// sort LSD sobre registros de 64 bits em tempo linear (passadas por v, u e peso).
+// Pesos reais arbitrários ou vértices negativos caem no std::sort. Os dois
+// caminhos produzem a ordem de std::sort sobre a tupla (peso, u, v): empates de
+// peso são desfeitos por (u, v), como antes do radix sort.
+class EdgeSort {
+public:
+    typedef std::tuple<double, int, int> WeightedEdge;
+
+    // Ordena as arestas por (peso, u, v). threads = 0 usa todas as disponíveis
+    static void sortEdges(std::vector<WeightedEdge>& edges, unsigned threads = 0);
+
+    // Tenta converter os pesos em chaves inteiras que preservam a ordem:
+    // peso inteiro -> chave = peso; peso = sqrt(inteiro) -> chave = peso².
+    // Retorna false se algum peso não admitir chave exata.
+    static bool computeIntegerKeys(const std::vector<WeightedEdge>& edges,
+                                   std::vector<uint32_t>& keys, uint32_t& maxKey);
+
+    // Radix sort LSD estável dos registros pelos bits [shift, shift + keyBits).
+    // O histograma e a distribuição de cada passada são feitos em paralelo.
+    static void radixSortRecords(std::vector<uint64_t>& records, int shift, int keyBits,
+                                 unsigned threads = 0);
+
+private:
+    static int bitsFor(uint64_t value);
+};
+
+#endif
@@ -7,6 +7,8 @@
 #include <string>
 #include <cstdint>
 
+// Vértice do pixel (x, y) = y * largura + x, com rótulo igual ao índice
+// (contrato de Segmentation::segmentGraphTiled e computeRegionStats)
 class ImageGraphConverter {
 public:
     // Para imagem colorida RGB
@@ -14,6 +16,10 @@ public:
 
     // Para imagem em tons de cinza
     static void imageToGraphGray(const std::vector<std::vector<uint8_t>>& image, UndirectedGraph& graph, bool eightConnected = false);
+
+private:
+    // Adiciona os vértices de todos os pixels em ordem row-major
+    static void addPixelVertices(int rows, int cols, UndirectedGraph& graph);
 };
 
 #endif
@@ -0,0 +1,123 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+// Heap binário de mínimo sobre identificadores 0..capacity-1 com posição indexada:
+// contains em O(1) e update/remove de uma chave arbitrária em O(log n), sem
+// entradas obsoletas na fila. Empates são desfeitos pelo identificador, então a
+// ordem de retirada é determinística.
+template <typename Key, typename Compare = std::less<Key>>
+class IndexedMinHeap {
+private:
+    std::vector<int> heap;          // identificadores em ordem de heap
+    std::vector<int> position;      // posição no heap ou -1
+    std::vector<Key> keys;
+    Compare less;
+
+    bool before(int a, int b) const {
+        if (less(keys[a], keys[b])) return true;
+        if (less(keys[b], keys[a])) return false;
+        return a < b;
+    }
+
+    void place(size_t i, int id) {
+        heap[i] = id;
+        position[id] = static_cast<int>(i);
+    }
+
+    void siftUp(size_t i) {
+        int id = heap[i];
+        while (i > 0) {
+            size_t parent = (i - 1) / 2;
+            if (!before(id, heap[parent])) break;
+            place(i, heap[parent]);
+            i = parent;
+        }
+        place(i, id);
+    }
+
+    void siftDown(size_t i) {
+        int id = heap[i];
+        size_t n = heap.size();
+        while (true) {
+            size_t child = 2 * i + 1;
+            if (child >= n) break;
+            if (child + 1 < n && before(heap[child + 1], heap[child])) child++;
+            if (!before(heap[child], id)) break;
+            place(i, heap[child]);
+            i = child;
+        }
+        place(i, id);
+    }
+
+public:
+    explicit IndexedMinHeap(int capacity = 0, Compare compare = Compare())
+        : position(capacity, -1), keys(capacity), less(compare) {}
+
+    // Redimensiona e esvazia o heap
+    void reset(int capacity) {
+        heap.clear();
+        position.assign(capacity, -1);
+        keys.resize(capacity);
+    }
+
+    void clear() {
+        for (int id : heap) position[id] = -1;
+        heap.clear();
+    }
+
+    bool empty() const { return heap.empty(); }
+    size_t size() const { return heap.size(); }
+    int capacity() const { return static_cast<int>(position.size()); }
+    bool contains(int id) const { return position[id] != -1; }
+    const Key& keyOf(int id) const { return keys[id]; }
+
+    int top() const {
+        if (heap.empty()) throw std::out_of_range("Heap is empty.");
+        return heap.front();
+    }
+    const Key& topKey() const { return keys[top()]; }
+
+    // Insere id ou altera sua chave (para mais ou para menos)
+    void push(int id, const Key& key) {
+        if (contains(id)) {
+            update(id, key);
+            return;
+        }
+        keys[id] = key;
+        heap.push_back(id);
+        siftUp(heap.size() - 1);
+    }
+
+    void update(int id, const Key& key) {
+        bool decrease = less(key, keys[id]);
+        keys[id] = key;
+        if (decrease) siftUp(position[id]);
+        else siftDown(position[id]);
+    }
+
+    int pop() {
+        int id = top();
+        remove(id);
+        return id;
+    }
+
+    void remove(int id) {
+        size_t i = position[id];
+        int last = heap.back();
+        heap.pop_back();
+        position[id] = -1;
+        if (last == id) return;
+
+        place(i, last);
+        siftUp(i);
+        siftDown(position[last]);
+    }
+};
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef KNN_GRAPH_H
+#define KNN_GRAPH_H
+
+#include "utils/csr_graph.h"
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+// Grafo k-NN sobre N vetores de características (cor + posição, descritores...),
+// para segmentar no espaço de características em vez da grade de pixels.
+//
+// Vizinhos exatos por kd-tree: divisão na mediana da dimensão de maior extensão,
+// com cortes alinhados a folhas de LEAF pontos. Cada folha guarda seus pontos
+// transpostos ([dimensão][ponto]), então as LEAF distâncias de uma folha saem
+// de um laço vetorizado por faixas, qualquer que seja a dimensão. Os níveis de
+// cima da árvore são construídos em paralelo; as consultas são divididas entre
+// threads na ordem das folhas (consultas vizinhas tocam as mesmas folhas).
+// A busca é exata, não aproximada: em dimensão alta (descritores com dezenas de
+// dimensões) a poda por hiperplano quase nunca descarta o outro lado e a consulta
+// degrada para força bruta, O(N) distâncias por ponto (O(N^2) no total).
+//
+// O grafo é a simetrização (u ~ v se v está entre os k vizinhos de u ou vice-
+// versa), com peso = distância euclidiana e arestas (peso, u, v), u < v,
+// ordenadas por (u, v): serve a CSRGraph/GraphIFT e a Segmentation::segmentGraph.
+class KnnGraphBuilder {
+public:
+    static constexpr int LEAF = 16;
+
+    // k vizinhos por ponto, ordenados por distância (empate: menor índice).
+    // Com menos de k + 1 pontos sobram posições com índice -1 e distância +∞
+    struct Neighbors {
+        int k = 0;
+        std::vector<int> index;         // [i * k + j]
+        std::vector<float> distance;    // euclidiana
+    };
+
+    explicit KnnGraphBuilder(int k, unsigned threads = 0);
+
+    // points: N x dimensions, row-major
+    Neighbors findNeighbors(const std::vector<float>& points, size_t dimensions) const;
+
+    // Arestas simetrizadas (peso, u, v), u < v, em ordem de (u, v)
+    std::vector<std::tuple<double, int, int>> buildEdgeList(const std::vector<float>& points,
+                                                            size_t dimensions) const;
+
+    CSRGraph buildCSR(const std::vector<float>& points, size_t dimensions) const;
+
+    // Vértice i com rótulo to_string(i), como em CSRGraph::toUndirectedGraph
+    void buildUndirectedGraph(const std::vector<float>& points, size_t dimensions,
+                              UndirectedGraph& graph) const;
+
+    int getK() const { return k; }
+    unsigned getThreads() const { return threads; }
+    void setThreads(unsigned value) { threads = value; }
+
+private:
+    int k;
+    unsigned threads;
+
+    static std::vector<std::tuple<double, int, int>> symmetrize(const Neighbors& neighbors, int pointCount,
+                                                                unsigned threads);
+};
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Utilitários mínimos de paralelismo sobre std::thread.
+// A partição de um intervalo em blocos depende apenas do tamanho do intervalo e
+// do número de blocos, então quem acumula resultados por bloco e combina na ordem
+// dos blocos obtém resultados determinísticos independentemente do escalonamento.
+namespace Parallel {
+
+    // Número de threads a usar: `requested` se > 0, senão hardware_concurrency()
+    inline unsigned resolveThreads(unsigned requested = 0) {
+        if (requested > 0) return requested;
+        unsigned hw = std::thread::hardware_concurrency();
+        return hw > 0 ? hw : 1;
+    }
+
+    // Número de blocos para n elementos: no máximo um por thread e nenhum bloco
+    // menor que minChunk (evita criar threads para trabalhos pequenos)
+    inline size_t chunkCount(size_t n, unsigned threads = 0, size_t minChunk = 1 << 14) {
+        size_t maxChunks = resolveThreads(threads);
+        size_t byGrain = std::max<size_t>(1, n / std::max<size_t>(1, minChunk));
+        return std::max<size_t>(1, std::min(maxChunks, byGrain));
+    }
+
+    // Início do bloco `chunk` de [0, n) dividido em `chunks` partes
+    inline size_t chunkBegin(size_t n, size_t chunks, size_t chunk) {
+        return n * chunk / chunks;
+    }
+
+    // Executa fn(chunk, begin, end) para cada bloco de [0, n), um bloco por thread.
+    // O bloco 0 roda na thread chamadora; exceções são propagadas ao chamador.
+    template <typename Function>
+    void forChunks(size_t n, size_t chunks, Function fn) {
+        if (chunks <= 1) {
+            fn(size_t(0), size_t(0), n);
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(chunks);
+        std::vector<std::thread> workers;
+        workers.reserve(chunks - 1);
+
+        for (size_t c = 1; c < chunks; ++c) {
+            workers.emplace_back([&, c]() {
+                try {
+                    fn(c, chunkBegin(n, chunks, c), chunkBegin(n, chunks, c + 1));
+                } catch (...) {
+                    errors[c] = std::current_exception();
+                }
+            });
+        }
+
+        try {
+            fn(size_t(0), size_t(0), chunkBegin(n, chunks, 1));
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+
+        for (auto& worker : workers) worker.join();
+
+        for (const auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+
+    // Equipe persistente para laços que chamariam forChunks muitas vezes sobre o
+    // mesmo intervalo (iterações de CG, passos de Prim): as chunks - 1 threads são
+    // criadas uma vez e cada run() custa só uma rodada de sincronização.
+    // Mesma partição, bloco 0 na thread chamadora e exceções propagadas, como em
+    // forChunks. run() não é reentrante nem pode ser chamado de várias threads.
+    class ChunkTeam {
+    public:
+        ChunkTeam(size_t n, size_t chunks) : n(n), chunks(std::max<size_t>(1, chunks)), errors(this->chunks) {
+            try {
+                for (size_t c = 1; c < this->chunks; ++c) workers.emplace_back([this, c]() { work(c); });
+            } catch (...) {
+                stop();
+                throw;
+            }
+        }
+
+        ~ChunkTeam() { stop(); }
+
+        ChunkTeam(const ChunkTeam&) = delete;
+        ChunkTeam& operator=(const ChunkTeam&) = delete;
+
+        size_t chunkCount() const { return chunks; }
+
+        // Executa fn(chunk, begin, end) para cada bloco e espera todos terminarem
+        template <typename Function>
+        void run(Function fn) {
+            if (workers.empty()) {
+                fn(size_t(0), size_t(0), n);
+                return;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                task = &fn;
+                call = [](void* f, size_t c, size_t begin, size_t end) { (*static_cast<Function*>(f))(c, begin, end); };
+                pending = workers.size();
+                generation++;
+            }
+            started.notify_all();
+
+            try {
+                fn(size_t(0), size_t(0), chunkBegin(n, chunks, 1));
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                finished.wait(lock, [this]() { return pending == 0; });
+            }
+
+            for (auto& error : errors) {
+                if (error) {
+                    std::exception_ptr first = error;
+                    std::fill(errors.begin(), errors.end(), nullptr);
+                    std::rethrow_exception(first);
+                }
+            }
+        }
+
+    private:
+        size_t n, chunks;
+        std::vector<std::exception_ptr> errors;
+        std::vector<std::thread> workers;
+
+        std::mutex mutex;
+        std::condition_variable started, finished;
+        void* task = nullptr;
+        void (*call)(void*, size_t, size_t, size_t) = nullptr;
+        size_t generation = 0, pending = 0;
+        bool stopping = false;
+
+        void work(size_t c) {
+            size_t seen = 0;
+            while (true) {
+                std::unique_lock<std::mutex> lock(mutex);
+                started.wait(lock, [&]() { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+                lock.unlock();
+
+                try {
+                    call(task, c, chunkBegin(n, chunks, c), chunkBegin(n, chunks, c + 1));
+                } catch (...) {
+                    errors[c] = std::current_exception();
+                }
+
+                lock.lock();
+                if (--pending == 0) finished.notify_one();
+            }
+        }
+
+        void stop() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stopping = true;
+            }
+            started.notify_all();
+            for (auto& worker : workers) worker.join();
+        }
+    };
+
+    // Executa fn(i) para todo i em [0, n) em paralelo
+    template <typename Function>
+    void forEach(size_t n, Function fn, unsigned threads = 0, size_t minChunk = 1 << 14) {
+        forChunks(n, chunkCount(n, threads, minChunk), [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) fn(i);
+        });
+    }
+}
+
+#endif
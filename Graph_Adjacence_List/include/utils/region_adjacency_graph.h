@@ -0,0 +1,62 @@
+#ifndef REGION_ADJACENCY_GRAPH_H
+#define REGION_ADJACENCY_GRAPH_H
+
+#include "utils/csr_graph.h"
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Aresta entre duas regiões adjacentes (a < b)
+struct RegionEdge {
+    int a = 0;
+    int b = 0;
+    int boundaryLength = 0;     // pares de pixels 4-adjacentes na fronteira
+    double contrastSum = 0.0;   // soma das diferenças de cor ao longo da fronteira
+
+    // Contraste médio da fronteira
+    double contrast() const { return boundaryLength > 0 ? contrastSum / boundaryLength : 0.0; }
+};
+
+// Grafo de adjacência de regiões construído a partir dos rótulos densos de
+// Segmentation::segmentGraph. Somente os pixels de fronteira geram trabalho; o
+// resultado fica em CSR (peso do arco = contraste médio, arcEdge = índice em getEdges()).
+class RegionAdjacencyGraph {
+private:
+    std::vector<int> area;
+    std::vector<std::array<uint64_t, 3>> colorSum;
+    std::vector<RegionEdge> edges;      // ordenadas por (a, b)
+    CSRGraph csr;
+
+    template <typename PixelColor, typename PixelDifference>
+    static RegionAdjacencyGraph build(int width, int height, const std::vector<int>& labels,
+                                      PixelColor colorAt, PixelDifference difference,
+                                      unsigned threads);
+
+public:
+    // Contraste = distância euclidiana RGB (mesma métrica de imageToGraphRGB)
+    static RegionAdjacencyGraph fromLabels(const std::vector<std::vector<std::array<uint8_t, 3>>>& image,
+                                           const std::vector<int>& labels, unsigned threads = 0);
+
+    // Contraste = diferença absoluta de intensidade (mesma métrica de imageToGraphGray)
+    static RegionAdjacencyGraph fromLabels(const std::vector<std::vector<uint8_t>>& image,
+                                           const std::vector<int>& labels, unsigned threads = 0);
+
+    int getRegionCount() const { return static_cast<int>(area.size()); }
+    int getArea(int region) const { return area[region]; }
+    std::array<double, 3> getMeanColor(int region) const;
+    const std::vector<RegionEdge>& getEdges() const { return edges; }
+    const CSRGraph& getCSR() const { return csr; }
+
+    // Funde repetidamente o par adjacente de menor contraste (fila de prioridade
+    // indexada; a fronteira resultante soma comprimentos e contrastes) até restarem
+    // targetRegionCount regiões ou o menor contraste exceder maxContrast.
+    // Retorna o novo rótulo denso de cada região original.
+    std::vector<int> mergeRegions(int targetRegionCount,
+                                  double maxContrast = std::numeric_limits<double>::infinity()) const;
+
+    // Aplica o mapeamento de regiões aos rótulos por pixel
+    static std::vector<int> relabel(const std::vector<int>& labels, const std::vector<int>& regionMap);
+};
+
+#endif
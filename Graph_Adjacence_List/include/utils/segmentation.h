@@ -7,10 +7,70 @@
 #include <tuple>
 #include <string>
 #include <unordered_map>
+#include <array>
+#include <cstdint>
+
+// Estatísticas de uma região da segmentação (rótulo denso 0..k-1)
+struct RegionStats {
+    int area = 0;                               // número de pixels
+    int minX = 0, minY = 0, maxX = -1, maxY = -1; // caixa delimitadora (inclusiva)
+    std::array<double, 3> meanColor = {0.0, 0.0, 0.0}; // RGB médio (cinza: 3 canais iguais)
+    std::vector<int> neighbors;                 // regiões 4-adjacentes, em ordem crescente
+};
 
 class Segmentation {
 public:
-    static vector<int> segmentGraph(UndirectedGraph& graph, double k, int min_size);
+    // Retorna rótulos densos 0..k-1 por vértice (ordenados pelo índice da raiz).
+    // verbose = true imprime cada componente no console.
+    static vector<int> segmentGraph(UndirectedGraph& graph, double k, int min_size,
+                                    bool verbose = false);
+
+    // Versão paralela para grafos de imagem (vértice i = y * width + x).
+    // Cada bloco tileSize x tileSize é segmentado em uma thread; depois as arestas
+    // de costura entre blocos são processadas em ordem com o mesmo predicado (join).
+    // O resultado é determinístico para um dado tileSize.
+    // A passagem de min_size segue o mesmo esquema: cada bloco une em paralelo os
+    // componentes pequenos contidos nele; arestas de costura e as que tocam
+    // componentes que atravessam blocos são processadas depois, em ordem de peso.
+    static vector<int> segmentGraphTiled(UndirectedGraph& graph, int width, int height,
+                                         double k, int min_size, int tileSize = 256,
+                                         unsigned threads = 0, bool verbose = false);
+
+    // Área, caixa delimitadora, cor média e adjacência de cada região em uma única
+    // redução paralela sobre a imagem. labels[y * width + x] é o rótulo do pixel
+    // (saída de segmentGraph sobre um grafo de ImageGraphConverter); rótulos fora
+    // de [0, width * height) lançam invalid_argument
+    static std::vector<RegionStats> computeRegionStats(
+        const std::vector<std::vector<std::array<uint8_t, 3>>>& image,
+        const std::vector<int>& labels, unsigned threads = 0);
+
+    static std::vector<RegionStats> computeRegionStats(
+        const std::vector<std::vector<uint8_t>>& image,
+        const std::vector<int>& labels, unsigned threads = 0);
+
+private:
+    typedef std::tuple<double, int, int> WeightedEdge;
+
+    // Arestas (peso, u, v) com u < v
+    static std::vector<WeightedEdge> collectEdges(UndirectedGraph& graph);
+
+    // Segunda passagem: une componentes menores que min_size, em ordem de peso
+    static void mergeSmallComponents(UnionFind& ds, const std::vector<WeightedEdge>& edges,
+                                     int min_size, unsigned threads);
+
+    // min_size por bloco (byTile/bucketStart = distribuição de segmentGraphTiled,
+    // último balde = costura) e passagem ordenada para o restante
+    static void mergeSmallComponentsTiled(UnionFind& ds, const std::vector<WeightedEdge>& byTile,
+                                          const std::vector<size_t>& bucketStart, int width,
+                                          int tileSize, int min_size, unsigned threads);
+
+    // Rótulos densos por vértice e, se verbose, impressão dos componentes
+    static vector<int> finalizeComponents(UndirectedGraph& graph, UnionFind& ds,
+                                          bool verbose, unsigned threads);
+
+    template <typename PixelAccess>
+    static std::vector<RegionStats> regionStats(int width, int height, const std::vector<int>& labels,
+                                                PixelAccess pixelAt, unsigned threads);
 };
 
 #endif
@@ -0,0 +1,52 @@
+#ifndef SEGMENTATION_HIERARCHY_H
+#define SEGMENTATION_HIERARCHY_H
+
+#include "undirected_Graph.h"
+#include <string>
+#include <tuple>
+#include <vector>
+
+// Hierarquia de fusões construída uma única vez (árvore binária de partições da
+// floresta geradora mínima, na ordem de Kruskal). Folhas 0..n-1 são os vértices;
+// cada fusão cria um nó interno com índice maior que os dos filhos e altitude
+// igual ao peso da aresta que a causou. Qualquer corte (por escala ou por número
+// de regiões) é extraído em O(n), sem reordenar arestas.
+class SegmentationHierarchy {
+private:
+    int leafCount;
+    std::vector<int> parent;        // pai de cada nó (-1 nas raízes)
+    std::vector<double> altitude;   // peso da fusão (0 nas folhas)
+
+    // Rotula as folhas descendo da raiz: um nó abre nova região quando a fusão
+    // do pai não é mantida pelo corte
+    template <typename KeepMerge>
+    std::vector<int> cut(KeepMerge keepMerge) const;
+
+public:
+    SegmentationHierarchy() : leafCount(0) {}
+
+    // Constrói a hierarquia a partir do grafo (arestas ordenadas por EdgeSort)
+    static SegmentationHierarchy build(UndirectedGraph& graph);
+
+    // Constrói a partir de arestas (peso, u, v) já ordenadas por peso
+    static SegmentationHierarchy fromSortedEdges(int vertexCount,
+                                                 const std::vector<std::tuple<double, int, int>>& edges);
+
+    int getLeafCount() const { return leafCount; }
+    int getNodeCount() const { return static_cast<int>(parent.size()); }
+    int getMergeCount() const { return getNodeCount() - leafCount; }
+    int getParent(int node) const { return parent[node]; }
+    double getAltitude(int node) const { return altitude[node]; }
+
+    // Rótulos densos por vértice mantendo as fusões com altitude <= threshold
+    std::vector<int> cutAtAltitude(double threshold) const;
+
+    // Rótulos densos com regionCount regiões (limitado ao número de componentes conexas)
+    std::vector<int> cutToRegionCount(int regionCount) const;
+
+    // Serialização binária (pai e altitude de cada nó)
+    bool save(const std::string& filename) const;
+    static bool load(const std::string& filename, SegmentationHierarchy& hierarchy);
+};
+
+#endif
@@ -2,23 +2,42 @@
 #define DISJOINT_SET_H
 
 #include <vector>
+#include <cstdint>
+
+// Union-find para a segmentação de Felzenszwalb.
+// Cada nó guarda pai, tamanho e diferença interna em um único registro, então um
+// join toca uma linha de cache por raiz; tamanho e diferença interna só têm
+// significado nas raízes. find é iterativo (path halving), sem risco de estouro
+// de pilha em cadeias longas. Index = int32_t ou int64_t (grafos acima de 2^31).
+template <typename Index>
+class BasicUnionFind {
 
-class UnionFind {
-    
 private:
-    std::vector<int> parent;
-    std::vector<int> rank;
-    std::vector<int> size;
-    std::vector<double> internalDiff;
+    struct Node {
+        Index parent;
+        Index size;             // válido apenas em raízes
+        double internalDiff;    // válido apenas em raízes
+    };
+
+    std::vector<Node> nodes;
+
+    // União por tamanho: a raiz menor passa a apontar para a maior
+    Index link(Index ru, Index rv, double internal);
 
 public:
-    UnionFind(int n);
+    BasicUnionFind(Index n);
 
-    int find(int u);
-    bool join(int u, int v, double weight, double k);
-    int getSize(int u);
-    double getInternalDiff(int u);
-    void forceJoin(int u, int v);
+    Index find(Index u);
+    Index findRoot(Index u) const;          // find sem compressão de caminho (somente leitura)
+    bool join(Index u, Index v, double weight, double k);
+    Index getSize(Index u);
+    Index getRootSize(Index root) const;    // tamanho registrado em uma raiz (somente leitura)
+    double getInternalDiff(Index u);
+    void forceJoin(Index u, Index v);
+    Index elementCount() const { return static_cast<Index>(nodes.size()); }
 };
 
+typedef BasicUnionFind<int32_t> UnionFind;
+typedef BasicUnionFind<int64_t> UnionFind64;
+
 #endif
@@ -0,0 +1,74 @@
+#ifndef VIDEO_IFT_SESSION_H
+#define VIDEO_IFT_SESSION_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "path_cost_function.h"
+#include "optimum_path_forest.h"
+#include "utils/indexed_heap.h"
+
+// Sessão de IFT para sequências de quadros com sementes rastreadas.
+// Mantém a floresta do quadro anterior e, a cada quadro, invalida apenas:
+//  - pixels cuja intensidade mudou mais que changeThreshold;
+//  - árvores de sementes removidas, movidas ou com rótulo/handicap alterado;
+//  - todos os dependentes desses pixels na floresta (descendentes).
+// A região invalidada é reconquistada pela IFT diferencial a partir da fronteira
+// válida e das sementes novas, então o custo por quadro acompanha o movimento da
+// cena e não a resolução. Mudanças abaixo do limiar não alteram caminhos: os
+// pesos de arco vêm sempre da imagem de referência (o quadro com apenas os pixels
+// acima do limiar atualizados), então a floresta é a de uma IFT do zero sobre ela.
+// A função de custo é referenciada e precisa viver tanto quanto a sessão.
+class VideoIFTSession {
+private:
+    const PathCostFunction& costFunction;
+    int changeThreshold;
+    bool eightConnected;
+
+    int width, height;
+    std::unique_ptr<Image> reference;   // imagem sobre a qual a floresta é ótima
+    OptimumPathForest forest;
+    IndexedMinHeap<double> queue;
+    std::unordered_map<int, std::pair<int, double>> seedState;  // pixel -> (rótulo, handicap)
+
+public:
+    struct FrameStats {
+        bool fullRun;               // primeiro quadro ou mudança de dimensões
+        size_t changedPixels;       // acima do limiar
+        size_t invalidatedPixels;   // alterados + dependentes + árvores removidas
+        size_t reconqueredPixels;   // retirados da fila neste quadro
+        double executionTimeMs;
+
+        void print() const;
+    };
+
+    VideoIFTSession(const PathCostFunction& costFunction, int changeThreshold = 0,
+                    bool eightConnected = false);
+
+    // Processa um quadro com as sementes propagadas para ele
+    const OptimumPathForest& processFrame(const Image& frame, const SeedSet& seeds);
+
+    // Descarta o estado: o próximo quadro é processado do zero
+    void reset();
+
+    const OptimumPathForest& getForest() const { return forest; }
+    FrameStats getLastFrameStats() const { return lastStats; }
+
+    void setChangeThreshold(int threshold) { changeThreshold = threshold; }
+    int getChangeThreshold() const { return changeThreshold; }
+
+private:
+    FrameStats lastStats;
+
+    // Marca pixels inválidos percorrendo predecessores com memorização (O(n))
+    size_t invalidate(const std::vector<char>& changed, const std::vector<char>& removedRoot,
+                      std::vector<char>& invalid) const;
+
+    // Loop da IFT diferencial sobre a referência (atualiza t também quando P(t) = s)
+    size_t conquer();
+};
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef VOLUME_H
+#define VOLUME_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "image.h"
+
+// Voxel: coordenadas 3D + intensidade (equivalente 3D de Pixel)
+struct Voxel {
+    int x, y, z;
+    uint8_t intensity;
+
+    Voxel() : x(0), y(0), z(0), intensity(0) {}
+    Voxel(int x, int y, int z, uint8_t intensity = 0) : x(x), y(y), z(z), intensity(intensity) {}
+
+    bool operator==(const Voxel& other) const {
+        return x == other.x && y == other.y && z == other.z;
+    }
+
+    // Índice linear: (z * height + y) * width + x
+    int64_t toLinearIndex(int width, int height) const {
+        return (static_cast<int64_t>(z) * height + y) * width + x;
+    }
+    static Voxel fromLinearIndex(int64_t index, int width, int height);
+
+    std::string toString() const;
+};
+
+// Relação de adjacência 3D: deslocamentos dos vizinhos (sem o centro)
+struct VolumeAdjacency {
+    std::vector<int> dx, dy, dz;
+
+    // 6 (faces), 18 (faces + arestas) ou 26 (faces + arestas + vértices)
+    static VolumeAdjacency create(int connectivity);
+
+    int size() const { return static_cast<int>(dx.size()); }
+};
+
+// Volume em armazenamento contíguo (fatia a fatia, linha a linha).
+// Índices são int64_t: volumes de 1024³ passam de 2^31 elementos em buffers auxiliares.
+class Volume {
+private:
+    int width, height, depth;
+    std::vector<uint8_t> data;
+
+public:
+    Volume() : width(0), height(0), depth(0) {}
+    Volume(int width, int height, int depth, uint8_t defaultValue = 0);
+
+    int getWidth() const { return width; }
+    int getHeight() const { return height; }
+    int getDepth() const { return depth; }
+    int64_t getVoxelCount() const { return static_cast<int64_t>(width) * height * depth; }
+
+    int64_t index(int x, int y, int z) const {
+        return (static_cast<int64_t>(z) * height + y) * width + x;
+    }
+    bool isValidCoordinate(int x, int y, int z) const {
+        return x >= 0 && x < width && y >= 0 && y < height && z >= 0 && z < depth;
+    }
+
+    // Acesso sem verificação (laços internos) e com verificação
+    uint8_t at(int64_t i) const { return data[i]; }
+    uint8_t getVoxelValue(int x, int y, int z) const;
+    void setVoxelValue(int x, int y, int z, uint8_t value);
+    Voxel getVoxel(int x, int y, int z) const;
+
+    const std::vector<uint8_t>& getData() const { return data; }
+
+    // Fatias como Image (visualização / integração com o código 2D)
+    Image getSlice(int z) const;
+    void setSlice(int z, const Image& slice);
+
+    // === STREAMING DE DISCO ===
+    // As fatias são lidas uma a uma direto no buffer final: nenhuma cópia
+    // intermediária do volume inteiro é criada.
+
+    // Arquivo bruto de 8 bits, fatia a fatia (sem cabeçalho)
+    static Volume loadRaw(const std::string& filename, int width, int height, int depth);
+    bool saveRaw(const std::string& filename) const;
+
+    // Uma imagem PGM (P2 ou P5, 8 bits) por fatia, na ordem de z
+    static Volume loadSlices(const std::vector<std::string>& filenames);
+};
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef VOLUME_IFT_H
+#define VOLUME_IFT_H
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "volume.h"
+#include "bucket_queue.h"
+#include "path_cost_function.h"
+
+// Semente em um voxel (custos inteiros: a fila é uma bucket queue)
+struct VoxelSeed {
+    Voxel voxel;
+    int label;
+    int handicap;
+
+    VoxelSeed(const Voxel& v, int lbl, int h = 0) : voxel(v), label(lbl), handicap(h) {}
+};
+
+// Resultado compacto da IFT volumétrica: vetores planos indexados por
+// Volume::index, com a menor largura que o problema permite:
+//   - custo: 16 bits quando o custo máximo possível cabe (f_max, ou f_sum em
+//     volumes pequenos; ver VolumeIFT::run), senão 32 bits;
+//   - rótulo: índice em labelValues, 8 bits até 255 rótulos distintos, senão 16;
+//   - predecessor (opcional): direção da adjacência, 1 byte.
+// Memória por voxel: 3 bytes no caso comum (f_max, até 255 rótulos), até 6 com
+// custos de 32 bits e rótulos de 16, +1 com predecessores; mais 1 byte do
+// próprio Volume. Um volume 1024³ com f_max cabe em cerca de 4 GB no total.
+struct VolumeIFTResult {
+    static constexpr int32_t UNREACHED = std::numeric_limits<int32_t>::max();
+    static constexpr uint8_t NO_PREDECESSOR = 0xFF;
+
+    int width = 0, height = 0, depth = 0;
+
+    // Exatamente um dos vetores de cada par é preenchido
+    std::vector<uint16_t> cost16;       // 0xFFFF se não conquistado
+    std::vector<uint32_t> cost32;       // 0xFFFFFFFF se não conquistado
+    std::vector<uint8_t> label8;        // 0xFF se não conquistado
+    std::vector<uint16_t> label16;      // 0xFFFF se não conquistado
+
+    std::vector<int> labelValues;       // rótulos das sementes, crescentes
+    std::vector<uint8_t> predecessor;   // vazio se não solicitado; NO_PREDECESSOR nas raízes
+    VolumeAdjacency adjacency;          // decodifica predecessor
+
+    int64_t index(int x, int y, int z) const {
+        return (static_cast<int64_t>(z) * height + y) * width + x;
+    }
+
+    // -1 se não conquistado
+    int getLabel(int64_t i) const;
+    int getLabel(int x, int y, int z) const { return getLabel(index(x, y, z)); }
+
+    // UNREACHED se não conquistado
+    int32_t getCost(int64_t i) const;
+    int32_t getCost(int x, int y, int z) const { return getCost(index(x, y, z)); }
+
+    // Índice do predecessor; -1 nas raízes, não conquistados ou sem predecessores
+    int64_t getPredecessor(int64_t i) const;
+
+    int getCostBits() const { return cost16.empty() ? 32 : 16; }
+    int getLabelBits() const { return label16.empty() ? 8 : 16; }
+
+    // Fatia de rótulos como Image (rótulos truncados em 255, não conquistado = 0)
+    Image getLabelSlice(int z) const;
+
+    size_t memoryBytes() const;
+};
+
+// IFT em volumes com adjacência 6/18/26 e bucket queue circular.
+// As funções de custo existentes são usadas como estão: extendCost define a
+// composição do caminho e getArcWeight é amostrado uma vez para cada par de
+// intensidades (tabela 256x256), o que vale para todas as estratégias de peso
+// do projeto (dependem só das intensidades). Pesos são arredondados para inteiros.
+// Custos de 16 bits são usados quando o maior custo possível cabe: se extendCost
+// se comporta como máximo, esse custo é max(maior handicap, maior peso); senão,
+// maior handicap + (voxels - 1) * maior peso.
+class VolumeIFT {
+private:
+    VolumeAdjacency adjacency;
+    bool keepPredecessors;
+
+    // Tabela w(a, b) em [a * 256 + b]; retorna o maior peso
+    int buildWeightTable(const PathCostFunction& costFunction, std::vector<int>& table) const;
+
+    // Propagação com custos em CostT e índices de rótulo em LabelT
+    template <typename CostT, typename LabelT>
+    void propagate(const Volume& volume, const PathCostFunction& costFunction,
+                   const std::vector<int>& weights, int maxWeight,
+                   const std::vector<VoxelSeed>& seeds, VolumeIFTResult& result,
+                   std::vector<CostT>& cost, std::vector<LabelT>& label) const;
+
+public:
+    VolumeIFT(int connectivity = 6, bool keepPredecessors = false)
+        : adjacency(VolumeAdjacency::create(connectivity)), keepPredecessors(keepPredecessors) {}
+
+    VolumeIFTResult run(const Volume& volume, const PathCostFunction& costFunction,
+                        const std::vector<VoxelSeed>& seeds) const;
+
+    void setConnectivity(int connectivity) { adjacency = VolumeAdjacency::create(connectivity); }
+    int getConnectivity() const { return adjacency.size(); }
+
+    void setKeepPredecessors(bool keep) { keepPredecessors = keep; }
+    bool getKeepPredecessors() const { return keepPredecessors; }
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef WATERSHED_H
+#define WATERSHED_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "image.h"
+#include "seed_set.h"
+#include "ift_result.h"
+
+// Watershed por marcadores: IFT com f_max sobre um relevo uint8, na
+// CircularBucketQueue (256 baldes FIFO). Cada pixel entra na fila uma única vez
+// (com f_max o primeiro custo oferecido já é ótimo) e os empates de um platô saem
+// na ordem de chegada, então platôs são divididos pela distância geodésica às
+// suas bordas, não pela ordem de varredura.
+//
+// Relevo: a própria imagem ou um gradiente calculado sob demanda quando o pixel
+// é alcançado pela primeira vez (não há passada separada nem imagem auxiliar):
+//  - Sobel: (|Gx| + |Gy|) / 8, que cabe em 0..255;
+//  - Morphological: máximo - mínimo na vizinhança 3x3.
+//
+// Com watershedLines, o rótulo é decidido ao sair da fila (Meyer): pixel cujos
+// vizinhos já rotulados têm rótulos distintos vira linha (rótulo 0) e não propaga.
+// O handicap das sementes é ignorado: marcadores começam com o valor do relevo.
+class WatershedTransform {
+public:
+    enum class Relief { Image, Sobel, Morphological };
+
+    struct Result {
+        int width, height;
+        std::vector<int> labels;        // row-major; 0 = linha, -1 = não alcançado
+        std::vector<uint8_t> costs;     // f_max: maior relevo no caminho ótimo
+        size_t linePixels;
+        double executionTimeMs;
+
+        // Resultado compatível com IFTResult (C e L; P fica vazio)
+        std::unique_ptr<IFTResult> toIFTResult(const Image& image) const;
+    };
+
+    explicit WatershedTransform(Relief relief = Relief::Sobel, bool watershedLines = false,
+                                bool eightConnected = true)
+        : relief(relief), watershedLines(watershedLines), eightConnected(eightConnected) {}
+
+    Result run(const Image& image, const SeedSet& markers) const;
+
+    void setRelief(Relief r) { relief = r; }
+    Relief getRelief() const { return relief; }
+
+    void setWatershedLines(bool enabled) { watershedLines = enabled; }
+    bool getWatershedLines() const { return watershedLines; }
+
+    void setConnectivity(bool eightConn) { eightConnected = eightConn; }
+    bool getConnectivity() const { return eightConnected; }
+
+private:
+    Relief relief;
+    bool watershedLines;
+    bool eightConnected;
+};
+
+#endif
@@ -97,11 +97,11 @@ vector<Edge> Graph::getNeighborsInternal(int vertex){
     return adjList[vertex];
 }
 
-unordered_map<string, int> Graph::getLabeltoIndex(){
+const unordered_map<string, int>& Graph::getLabeltoIndex() const {
     return labelToIndex;
 }
 
-vector<Vertex> Graph::getVertices(){
+const vector<Vertex>& Graph::getVertices() const {
     return vertices;
 }
 
@@ -1,5 +1,7 @@
 #include "undirected_Graph.h"
 #include "Edge.h"
+#include "utils/concurrent_union_find.h"
+#include "utils/parallel.h"
 
 #include <string>
 #include <iostream>
@@ -8,6 +10,7 @@
 #include <unordered_map>
 #include <vector>
 #include <algorithm>
+#include <atomic>
 
 void UndirectedGraph::addEdge(const string& from, const string& to, double weight) {
     if (!labelToIndex.count(from)) {
@@ -61,4 +64,93 @@ void UndirectedGraph::removeEdge(const string& from, const string& to){
     if(eTo.size() == beforeTo){
         throw runtime_error("Edge " + from + " <-> " + to + " not found" );
     }
-}
\ No newline at end of file
+}
+
+vector<tuple<double, int, int>> UndirectedGraph::getEdgeList() const {
+    vector<tuple<double, int, int>> edges;
+    for (int u = 0; u < int(adjList.size()); u++) {
+        for (const Edge& e : adjList[u]) {
+            if (u < e.to) {
+                edges.emplace_back(e.weight, u, e.to);
+            }
+        }
+    }
+    return edges;
+}
+
+vector<int> UndirectedGraph::minimumSpanningForest(unsigned threads) const {
+    vector<tuple<double, int, int>> edges = getEdgeList();
+    int n = adjList.size();
+    size_t m = edges.size();
+
+    ConcurrentUnionFind components(n);
+    vector<atomic<int>> best(n);
+    vector<int> active(m);
+    vector<int> forest;
+    for (size_t i = 0; i < m; i++) active[i] = int(i);
+
+    // Ordem total (peso, índice): garante que as arestas escolhidas não formam ciclo
+    auto lighter = [&](int a, int b) {
+        double wa = get<0>(edges[a]);
+        double wb = get<0>(edges[b]);
+        return wa < wb || (wa == wb && a < b);
+    };
+    auto offer = [&](int root, int e) {
+        int current = best[root].load(memory_order_relaxed);
+        while (current == -1 || lighter(e, current)) {
+            if (best[root].compare_exchange_weak(current, e, memory_order_relaxed)) break;
+        }
+    };
+
+    while (!active.empty()) {
+        Parallel::forEach(n, [&](size_t v) { best[v].store(-1, memory_order_relaxed); }, threads);
+
+        // 1. Cada componente escolhe sua aresta de saída mais leve
+        Parallel::forEach(active.size(), [&](size_t i) {
+            int e = active[i];
+            int ru = components.find(get<1>(edges[e]));
+            int rv = components.find(get<2>(edges[e]));
+            if (ru != rv) {
+                offer(ru, e);
+                offer(rv, e);
+            }
+        }, threads);
+
+        // 2. Contração: une as componentes pelas arestas escolhidas
+        size_t chunks = Parallel::chunkCount(n, threads);
+        vector<vector<int>> selected(chunks);
+        Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+            for (size_t v = begin; v < end; v++) {
+                int e = best[v].load(memory_order_relaxed);
+                if (e != -1 && components.unite(get<1>(edges[e]), get<2>(edges[e]))) {
+                    selected[c].push_back(e);
+                }
+            }
+        });
+
+        size_t added = 0;
+        for (const auto& chunk : selected) {
+            forest.insert(forest.end(), chunk.begin(), chunk.end());
+            added += chunk.size();
+        }
+        if (added == 0) break;
+
+        // 3. Filtragem: descarta arestas que ficaram internas a uma componente
+        chunks = Parallel::chunkCount(active.size(), threads);
+        vector<vector<int>> kept(chunks);
+        Parallel::forChunks(active.size(), chunks, [&](size_t c, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; i++) {
+                int e = active[i];
+                if (!components.sameSet(get<1>(edges[e]), get<2>(edges[e]))) {
+                    kept[c].push_back(e);
+                }
+            }
+        });
+
+        active.clear();
+        for (const auto& chunk : kept) active.insert(active.end(), chunk.begin(), chunk.end());
+    }
+
+    sort(forest.begin(), forest.end());
+    return forest;
+}
@@ -4,6 +4,8 @@
 #include <algorithm>
 #include <iomanip>
 #include <chrono>
+#include <stdexcept>
+#include <string>
 
 // === IMPLEMENTAÇÃO DA BUCKET QUEUE ===
 
@@ -222,6 +224,63 @@ HybridPriorityQueue::HybridStats HybridPriorityQueue::getUsageStats() const {
     return stats;
 }
 
+// === CIRCULAR BUCKET QUEUE ===
+
+CircularBucketQueue::CircularBucketQueue(int maxIncrement)
+    : bucketMask(0), maxIncrement(maxIncrement), currentCost(0), totalElements(0) {
+    if (maxIncrement < 0) {
+        throw std::invalid_argument("CircularBucketQueue: incremento máximo negativo");
+    }
+
+    // Potência de 2: o índice circular sai de uma máscara em vez de uma divisão
+    size_t count = 1;
+    while (count < static_cast<size_t>(maxIncrement) + 1) count <<= 1;
+    buckets.resize(count);
+    bucketMask = static_cast<int>(count - 1);
+}
+
+void CircularBucketQueue::push(int64_t element, int cost) {
+    bool outsideWindow = cost < currentCost || cost - currentCost > maxIncrement;
+    if (totalElements == 0 && outsideWindow) {
+        currentCost = cost;  // fila vazia: a janela pode recomeçar em qualquer custo
+    } else if (outsideWindow) {
+        throw std::out_of_range("CircularBucketQueue: custo " + std::to_string(cost) +
+                                " fora da janela [" + std::to_string(currentCost) + ", " +
+                                std::to_string(currentCost + maxIncrement) + "]");
+    }
+
+    buckets[cost & bucketMask].items.push_back(element);
+    totalElements++;
+}
+
+int64_t CircularBucketQueue::pop() {
+    if (empty()) {
+        throw std::runtime_error("CircularBucketQueue::pop() chamado em fila vazia");
+    }
+
+    while (buckets[currentCost & bucketMask].empty()) {
+        currentCost++;
+    }
+
+    Bucket& bucket = buckets[currentCost & bucketMask];
+    int64_t element = bucket.items[bucket.head++];
+    if (bucket.empty()) {
+        bucket.items.clear();
+        bucket.head = 0;
+    }
+    totalElements--;
+    return element;
+}
+
+void CircularBucketQueue::clear() {
+    for (auto& bucket : buckets) {
+        std::vector<int64_t>().swap(bucket.items);
+        bucket.head = 0;
+    }
+    currentCost = 0;
+    totalElements = 0;
+}
+
 // === FUNÇÕES AUXILIARES ===
 
 std::unique_ptr<BucketQueue> createOptimalBucketQueue(
@@ -0,0 +1,296 @@
+#include "distance_transform.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    const int64_t NO_DISTANCE = std::numeric_limits<int64_t>::max();
+
+    int64_t squaredDistance(int x, int y, int root, int width) {
+        int64_t dx = x - root % width;
+        int64_t dy = y - root / width;
+        return dx * dx + dy * dy;
+    }
+
+    // Número de bits significativos de x > 0 (posição do bit mais alto + 1)
+    inline int bitWidth(uint64_t x) {
+#if defined(_MSC_VER) && defined(_M_X64)
+        unsigned long index;
+        _BitScanReverse64(&index, x);
+        return static_cast<int>(index) + 1;
+#elif defined(__GNUC__) || defined(__clang__)
+        return 64 - __builtin_clzll(x);
+#else
+        int bits = 0;
+        while (x != 0) {
+            x >>= 1;
+            bits++;
+        }
+        return bits;
+#endif
+    }
+
+    // Radix heap: fila de prioridade monótona para chaves inteiras. Cada chave
+    // desce no máximo 64 baldes, então push/pop custam O(log C) amortizado
+    class RadixHeap {
+    public:
+        typedef std::pair<uint64_t, int> Entry;
+
+        RadixHeap() : last(0), count(0) {}
+
+        bool empty() const { return count == 0; }
+
+        void push(uint64_t key, int value) {
+            buckets[bucketOf(key)].push_back(Entry(key, value));
+            count++;
+        }
+
+        Entry pop() {
+            if (buckets[0].empty()) {
+                int i = 1;
+                while (buckets[i].empty()) i++;
+
+                uint64_t minKey = buckets[i][0].first;
+                for (const Entry& e : buckets[i]) minKey = std::min(minKey, e.first);
+                last = minKey;
+
+                for (const Entry& e : buckets[i]) buckets[bucketOf(e.first)].push_back(e);
+                buckets[i].clear();
+            }
+
+            Entry top = buckets[0].back();
+            buckets[0].pop_back();
+            count--;
+            return top;
+        }
+
+    private:
+        std::vector<Entry> buckets[65];
+        uint64_t last;
+        size_t count;
+
+        int bucketOf(uint64_t key) const {
+            return key == last ? 0 : bitWidth(key ^ last);
+        }
+    };
+}
+
+OptimumPathForest DistanceTransform::compute(int width, int height, const SeedSet& seeds, Method method) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Distance transform needs positive dimensions: " +
+                                    std::to_string(width) + "x" + std::to_string(height));
+    }
+
+    std::vector<Root> roots;
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (p.x < 0 || p.x >= width || p.y < 0 || p.y >= height) {
+            throw std::out_of_range("Seed outside image bounds: " + p.toString());
+        }
+        roots.push_back({p.y * width + p.x, seed.label});
+    }
+
+    return method == Method::IFT ? runIFT(width, height, roots) : runSeparable(width, height, roots);
+}
+
+OptimumPathForest DistanceTransform::fromMask(const Image& mask, Method method) {
+    int width = mask.getWidth();
+    int height = mask.getHeight();
+    std::vector<std::vector<uint8_t>> data = mask.getRawData();
+
+    std::vector<Root> roots;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            if (data[y][x] != 0) roots.push_back({y * width + x, data[y][x]});
+        }
+    }
+
+    return method == Method::IFT ? runIFT(width, height, roots) : runSeparable(width, height, roots);
+}
+
+std::vector<int64_t> DistanceTransform::squaredDistances(const OptimumPathForest& forest, int width) {
+    std::vector<int64_t> result(forest.size(), -1);
+    for (int v = 0; v < forest.size(); ++v) {
+        if (forest.isConquered(v)) {
+            result[v] = squaredDistance(v % width, v / width, forest.root[v], width);
+        }
+    }
+    return result;
+}
+
+OptimumPathForest DistanceTransform::runIFT(int width, int height, const std::vector<Root>& roots) {
+    int n = width * height;
+    OptimumPathForest forest;
+    forest.reset(n);
+    std::vector<int64_t> distance(n, NO_DISTANCE);
+    std::vector<char> done(n, 0);
+
+    RadixHeap queue;
+
+    for (const Root& r : roots) {
+        distance[r.index] = 0;
+        forest.root[r.index] = r.index;
+        forest.label[r.index] = r.label;
+        queue.push(0, r.index);
+    }
+
+    while (!queue.empty()) {
+        RadixHeap::Entry entry = queue.pop();
+
+        int v = entry.second;
+        if (done[v] || static_cast<int64_t>(entry.first) != distance[v]) continue;
+        done[v] = 1;
+
+        int x = v % width, y = v / width;
+        for (int d = 0; d < 8; ++d) {
+            int nx = x + DX[d], ny = y + DY[d];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int u = ny * width + nx;
+            if (done[u]) continue;
+
+            // C(u) = |u - R(v)|²: a raiz, não o custo de v, é propagada
+            int64_t extended = squaredDistance(nx, ny, forest.root[v], width);
+            if (extended < distance[u]) {
+                distance[u] = extended;
+                forest.root[u] = forest.root[v];
+                forest.label[u] = forest.label[v];
+                forest.predecessor[u] = v;
+                queue.push(static_cast<uint64_t>(extended), u);
+            }
+        }
+    }
+
+    // Verificação: raízes dos vizinhos-24 corrigem os raros pixels em que a
+    // raiz mais próxima não foi propagada pela vizinhança-8. Repete até estabilizar
+    if (!roots.empty()) {
+        std::vector<int> rootX(n), rootY(n);
+        for (int v = 0; v < n; ++v) {
+            rootX[v] = forest.root[v] % width;
+            rootY[v] = forest.root[v] / width;
+        }
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int y = 0; y < height; ++y) {
+                int y0 = std::max(y - 2, 0), y1 = std::min(y + 2, height - 1);
+                for (int x = 0; x < width; ++x) {
+                    int v = y * width + x;
+                    int x0 = std::max(x - 2, 0), x1 = std::min(x + 2, width - 1);
+                    for (int ny = y0; ny <= y1; ++ny) {
+                        for (int nx = x0; nx <= x1; ++nx) {
+                            int q = ny * width + nx;
+                            int64_t dx = x - rootX[q], dy = y - rootY[q];
+                            int64_t candidate = dx * dx + dy * dy;
+                            if (candidate < distance[v]) {
+                                distance[v] = candidate;
+                                forest.root[v] = forest.root[q];
+                                forest.label[v] = forest.label[q];
+                                forest.predecessor[v] = forest.root[q];
+                                rootX[v] = rootX[q];
+                                rootY[v] = rootY[q];
+                                changed = true;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    for (int v = 0; v < n; ++v) {
+        if (distance[v] != NO_DISTANCE) forest.cost[v] = std::sqrt(static_cast<double>(distance[v]));
+    }
+    return forest;
+}
+
+OptimumPathForest DistanceTransform::runSeparable(int width, int height, const std::vector<Root>& roots) {
+    int n = width * height;
+    OptimumPathForest forest;
+    forest.reset(n);
+
+    std::vector<int> rootLabel(n, -1);
+    std::vector<int> nearestY(n, -1);   // linha da semente mais próxima na mesma coluna
+    for (const Root& r : roots) {
+        rootLabel[r.index] = r.label;
+        nearestY[r.index] = r.index / width;
+    }
+
+    // Fase 1: varreduras verticais; cada bloco de colunas percorre as linhas
+    // em ordem, então os acessos são contíguos por linha
+    Parallel::forChunks(width, Parallel::chunkCount(width, 0, 64), [&](size_t, size_t begin, size_t end) {
+        int x0 = static_cast<int>(begin), x1 = static_cast<int>(end);
+        for (int y = 1; y < height; ++y) {
+            int* row = &nearestY[static_cast<size_t>(y) * width];
+            const int* above = row - width;
+            for (int x = x0; x < x1; ++x) {
+                if (row[x] == -1) row[x] = above[x];
+            }
+        }
+        for (int y = height - 2; y >= 0; --y) {
+            int* row = &nearestY[static_cast<size_t>(y) * width];
+            const int* below = row + width;
+            for (int x = x0; x < x1; ++x) {
+                int b = below[x];
+                if (b != -1 && (row[x] == -1 || b - y < y - row[x])) row[x] = b;
+            }
+        }
+    });
+
+    // Fase 2: por linha, envelope inferior das parábolas f(q) + (x - q)²
+    Parallel::forChunks(height, Parallel::chunkCount(height, 0, 16), [&](size_t, size_t begin, size_t end) {
+        std::vector<int> vertex(width);
+        std::vector<double> boundary(width + 1);
+        std::vector<int64_t> f(width);
+
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+            const int* row = &nearestY[static_cast<size_t>(y) * width];
+            int k = -1;
+
+            for (int q = 0; q < width; ++q) {
+                if (row[q] == -1) continue;
+                int64_t dy = y - row[q];
+                f[q] = dy * dy;
+
+                double s = -std::numeric_limits<double>::infinity();
+                while (k >= 0) {
+                    int p = vertex[k];
+                    s = (static_cast<double>(f[q] + static_cast<int64_t>(q) * q) -
+                         static_cast<double>(f[p] + static_cast<int64_t>(p) * p)) / (2.0 * (q - p));
+                    if (s > boundary[k]) break;
+                    k--;
+                }
+                k++;
+                vertex[k] = q;
+                boundary[k] = k == 0 ? -std::numeric_limits<double>::infinity() : s;
+                boundary[k + 1] = std::numeric_limits<double>::infinity();
+            }
+
+            if (k < 0) continue;  // nenhuma semente alcança esta linha
+
+            int j = 0;
+            for (int x = 0; x < width; ++x) {
+                while (boundary[j + 1] < x) j++;
+                int q = vertex[j];
+                int v = y * width + x;
+                int r = row[q] * width + q;
+                int64_t dx = x - q;
+
+                forest.cost[v] = std::sqrt(static_cast<double>(dx * dx + f[q]));
+                forest.root[v] = r;
+                forest.label[v] = rootLabel[r];
+                forest.predecessor[v] = r == v ? -1 : r;
+            }
+        }
+    });
+
+    return forest;
+}
@@ -0,0 +1,56 @@
+#include "graph_ift.h"
+#include <stdexcept>
+
+GraphIFT::GraphIFT(const CSRGraph& graph) : graph(graph) {
+    forest.reset(graph.getVertexCount());
+    queue.reset(graph.getVertexCount());
+}
+
+GraphIFT::GraphIFT(Graph& graph) : GraphIFT(CSRGraph::fromAdjacency(graph)) {}
+
+const OptimumPathForest& GraphIFT::run(const PathCostFunction& costFunction,
+                                       const std::vector<GraphSeed>& seeds) {
+    int n = graph.getVertexCount();
+    forest.reset(n);
+    queue.clear();
+
+    // Inicialização: C(t) = h(t) nas sementes
+    for (const GraphSeed& seed : seeds) {
+        if (seed.vertex < 0 || seed.vertex >= n) {
+            throw std::out_of_range("Seed vertex '" + std::to_string(seed.vertex) + "' is out of bounds.");
+        }
+        if (seed.handicap < forest.cost[seed.vertex]) {
+            forest.cost[seed.vertex] = seed.handicap;
+            forest.root[seed.vertex] = seed.vertex;
+            forest.label[seed.vertex] = seed.label;
+            queue.push(seed.vertex, seed.handicap);
+        }
+    }
+
+    // Loop principal: retira o vértice de menor custo e oferece caminhos aos vizinhos
+    while (!queue.empty()) {
+        int s = queue.pop();
+        for (int arc = graph.arcBegin(s); arc < graph.arcEnd(s); ++arc) {
+            int t = graph.arcTarget(arc);
+            double extended = costFunction.extendCost(forest.cost[s], graph.arcWeight(arc));
+            if (extended < forest.cost[t]) {
+                forest.cost[t] = extended;
+                forest.predecessor[t] = s;
+                forest.root[t] = forest.root[s];
+                forest.label[t] = forest.label[s];
+                queue.push(t, extended);
+            }
+        }
+    }
+
+    return forest;
+}
+
+GraphSeed GraphIFT::seedAt(Graph& graph, const std::string& vertexLabel, int label, double handicap) {
+    const unordered_map<string, int>& indices = graph.getLabeltoIndex();
+    auto it = indices.find(vertexLabel);
+    if (it == indices.end()) {
+        throw std::invalid_argument("Vertex '" + vertexLabel + "' does not exists.");
+    }
+    return GraphSeed(it->second, label, handicap);
+}
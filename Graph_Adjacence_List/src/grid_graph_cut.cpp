@@ -0,0 +1,442 @@
+#include "grid_graph_cut.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+
+    const int8_t NONE = -1;
+    const int8_t TERMINAL = 8;
+    const int8_t ORPHAN = 9;
+
+    // Resíduos de ida e volta somam 2 * B(p,q) e precisam caber em int16_t
+    const double MAX_LAMBDA = 16383.0;
+
+    // Direção oposta na ordem de DX/DY: N<->S, O<->L, NO<->SE, NE<->SO
+    inline int reverse(int d) { return d < 4 ? 3 - d : 11 - d; }
+}
+
+GridGraphCut::GridGraphCut(double lambda, double sigma, bool eightConnected)
+    : lambda(50.0), sigma(sigma), eightConnected(eightConnected),
+      width(0), height(0), stride(0), adjacency(0), objectLabel(1), terminalCapacity(0),
+      time(0), augmentations(0), orphanCount(0) {
+    setLambda(lambda);
+}
+
+void GridGraphCut::setLambda(double value) {
+    if (value <= 0.0 || value > MAX_LAMBDA) {
+        throw std::invalid_argument("Graph cut lambda must be in (0, " + std::to_string(MAX_LAMBDA) +
+                                    "]: " + std::to_string(value));
+    }
+    lambda = value;
+}
+
+void GridGraphCut::buildGraph(const Image& image) {
+    width = image.getWidth();
+    height = image.getHeight();
+    stride = width + 2;
+    adjacency = eightConnected ? 8 : 4;
+    for (int d = 0; d < 8; ++d) offsets[d] = DY[d] * stride + DX[d];
+
+    size_t paddedSize = static_cast<size_t>(stride) * (height + 2);
+    std::vector<std::vector<uint8_t>> data = image.getRawData();
+
+    // sigma automático: média dos quadrados das diferenças entre vizinhos
+    double sigmaSquared = sigma * sigma;
+    if (sigma <= 0.0) {
+        double sum = 0.0;
+        size_t pairs = 0;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (x + 1 < width) {
+                    double diff = data[y][x + 1] - data[y][x];
+                    sum += diff * diff;
+                    pairs++;
+                }
+                if (y + 1 < height) {
+                    double diff = data[y + 1][x] - data[y][x];
+                    sum += diff * diff;
+                    pairs++;
+                }
+            }
+        }
+        sigmaSquared = pairs > 0 ? sum / pairs : 0.0;
+        if (sigmaSquared <= 0.0) sigmaSquared = 1.0;
+    }
+
+    // Pesos por diferença de intensidade: ortogonais e diagonais (/√2)
+    int16_t weights[2][256];
+    for (int diff = 0; diff < 256; ++diff) {
+        double b = lambda * std::exp(-(diff * diff) / (2.0 * sigmaSquared));
+        weights[0][diff] = static_cast<int16_t>(std::lround(b));
+        weights[1][diff] = static_cast<int16_t>(std::lround(b / std::sqrt(2.0)));
+    }
+    terminalCapacity = 1 + 4 * weights[0][0] + (eightConnected ? 4 * weights[1][0] : 0);
+
+    for (int d = 0; d < 8; ++d) {
+        if (d < adjacency) residual[d].assign(paddedSize, 0);
+        else std::vector<int16_t>().swap(residual[d]);
+    }
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = (y + 1) * stride + x + 1;
+            for (int d = 0; d < adjacency; ++d) {
+                int nx = x + DX[d], ny = y + DY[d];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                residual[d][v] = weights[d < 4 ? 0 : 1][std::abs(data[y][x] - data[ny][nx])];
+            }
+        }
+    }
+
+    terminal.assign(paddedSize, 0);
+    seedSide.assign(paddedSize, 0);
+    tree.assign(paddedSize, 0);
+    parent.assign(paddedSize, NONE);
+    timestamp.assign(paddedSize, 0);
+    distance.assign(paddedSize, 0);
+    inActive.assign(paddedSize, 0);
+    marked.assign(paddedSize, 0);
+    active.clear();
+    orphans.clear();
+    time = 0;
+}
+
+void GridGraphCut::assignSeeds(const SeedSet& seeds, std::vector<int8_t>& sides) const {
+    sides.assign(static_cast<size_t>(stride) * (height + 2), 0);
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (p.x < 0 || p.x >= width || p.y < 0 || p.y >= height) {
+            throw std::out_of_range("Seed outside image bounds: " + p.toString());
+        }
+        sides[(p.y + 1) * stride + p.x + 1] = seed.label == objectLabel ? 1 : -1;
+    }
+}
+
+GridGraphCut::Result GridGraphCut::segment(const Image& image, const SeedSet& seeds, int label) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    objectLabel = label;
+    buildGraph(image);
+    assignSeeds(seeds, seedSide);
+
+    for (size_t v = 0; v < seedSide.size(); ++v) {
+        if (seedSide[v] == 0) continue;
+        terminal[v] = seedSide[v] * terminalCapacity;
+        tree[v] = seedSide[v];
+        parent[v] = TERMINAL;
+        timestamp[v] = time;
+        distance[v] = 1;
+        activate(static_cast<int>(v));
+    }
+
+    augmentations = 0;
+    orphanCount = 0;
+    Result result = collect(maxflow());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+GridGraphCut::Result GridGraphCut::updateSeeds(const SeedSet& seeds) {
+    if (!hasGraph()) {
+        throw std::runtime_error("GridGraphCut::updateSeeds called before segment");
+    }
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    std::vector<int8_t> sides;
+    assignSeeds(seeds, sides);
+
+    // Só os t-links mudam: o resíduo terminal absorve a diferença. Se troca de
+    // sinal, equivale a somar a mesma constante aos dois t-links do nó, o que
+    // não altera o corte mínimo
+    std::vector<int> changed;
+    for (size_t v = 0; v < sides.size(); ++v) {
+        if (sides[v] == seedSide[v]) continue;
+        terminal[v] += (sides[v] - seedSide[v]) * terminalCapacity;
+        seedSide[v] = sides[v];
+        marked[v] = 1;
+        changed.push_back(static_cast<int>(v));
+    }
+
+    time++;
+    augmentations = 0;
+    orphanCount = 0;
+
+    // Nós alterados viram raízes da árvore do sinal do seu resíduo; filhos que
+    // ficaram na árvore antiga ficam órfãos e a fronteira com a outra árvore é
+    // reativada
+    for (int v : changed) {
+        marked[v] = 0;
+        if (terminal[v] == 0) {
+            if (tree[v] != 0) makeOrphan(v, false);
+            continue;
+        }
+
+        int8_t side = terminal[v] > 0 ? 1 : -1;
+        if (tree[v] != side) {
+            for (int d = 0; d < adjacency; ++d) {
+                int u = v + offsets[d];
+                if (marked[u]) continue;
+                if (parent[u] == reverse(d)) makeOrphan(u, false);
+                bool open = side > 0 ? residual[d][v] > 0 : residual[reverse(d)][u] > 0;
+                if (tree[u] == -side && open) activate(u);
+            }
+            tree[v] = side;
+        }
+        parent[v] = TERMINAL;
+        timestamp[v] = time;
+        distance[v] = 1;
+        activate(v);
+    }
+    adopt();
+
+    Result result = collect(maxflow());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+void GridGraphCut::activate(int v) {
+    if (!inActive[v]) {
+        inActive[v] = 1;
+        active.push_back(v);
+    }
+}
+
+void GridGraphCut::makeOrphan(int v, bool front) {
+    parent[v] = ORPHAN;
+    orphanCount++;
+    if (front) orphans.push_front(v);
+    else orphans.push_back(v);
+}
+
+int64_t GridGraphCut::maxflow() {
+    int64_t flow = 0;
+    while (true) {
+        // Nó ativo corrente: continua na frente enquanto encontrar caminhos
+        int v = -1;
+        while (!active.empty()) {
+            int candidate = active.front();
+            if (tree[candidate] != 0) {
+                v = candidate;
+                break;
+            }
+            active.pop_front();
+            inActive[candidate] = 0;
+        }
+        if (v < 0) break;
+
+        int from, to, dir;
+        if (!grow(v, from, to, dir)) {
+            active.pop_front();
+            inActive[v] = 0;
+            continue;
+        }
+
+        time++;
+        flow += augment(from, to, dir);
+        augmentations++;
+        adopt();
+    }
+    return flow;
+}
+
+bool GridGraphCut::grow(int v, int& from, int& to, int& dir) {
+    int8_t side = tree[v];
+    for (int d = 0; d < adjacency; ++d) {
+        int u = v + offsets[d];
+        int r = reverse(d);
+
+        // S cresce por arcos v -> u; T por arcos u -> v
+        bool open = side > 0 ? residual[d][v] > 0 : residual[r][u] > 0;
+        if (!open) continue;
+
+        if (tree[u] == 0) {
+            tree[u] = side;
+            parent[u] = static_cast<int8_t>(r);
+            timestamp[u] = timestamp[v];
+            distance[u] = distance[v] + 1;
+            activate(u);
+        } else if (tree[u] != side) {
+            if (side > 0) { from = v; to = u; dir = d; }
+            else { from = u; to = v; dir = r; }
+            return true;
+        } else if (timestamp[u] <= timestamp[v] && distance[u] > distance[v]) {
+            // Heurística de BK: prefere pais mais próximos do terminal
+            parent[u] = static_cast<int8_t>(r);
+            timestamp[u] = timestamp[v];
+            distance[u] = distance[v] + 1;
+        }
+    }
+    return false;
+}
+
+int64_t GridGraphCut::augment(int from, int to, int dir) {
+    // Gargalo: arco de ligação, caminho até a fonte e caminho até o sumidouro
+    int32_t bottleneck = residual[dir][from];
+    for (int x = from; ; ) {
+        int8_t d = parent[x];
+        if (d == TERMINAL) {
+            bottleneck = std::min(bottleneck, terminal[x]);
+            break;
+        }
+        int p = x + offsets[d];
+        bottleneck = std::min<int32_t>(bottleneck, residual[reverse(d)][p]);
+        x = p;
+    }
+    for (int x = to; ; ) {
+        int8_t d = parent[x];
+        if (d == TERMINAL) {
+            bottleneck = std::min(bottleneck, -terminal[x]);
+            break;
+        }
+        bottleneck = std::min<int32_t>(bottleneck, residual[d][x]);
+        x += offsets[d];
+    }
+
+    residual[dir][from] -= bottleneck;
+    residual[reverse(dir)][to] += bottleneck;
+
+    for (int x = from; ; ) {
+        int8_t d = parent[x];
+        if (d == TERMINAL) {
+            terminal[x] -= bottleneck;
+            if (terminal[x] == 0) makeOrphan(x, true);
+            break;
+        }
+        int p = x + offsets[d];
+        residual[reverse(d)][p] -= bottleneck;
+        residual[d][x] += bottleneck;
+        if (residual[reverse(d)][p] == 0) makeOrphan(x, true);
+        x = p;
+    }
+    for (int x = to; ; ) {
+        int8_t d = parent[x];
+        if (d == TERMINAL) {
+            terminal[x] += bottleneck;
+            if (terminal[x] == 0) makeOrphan(x, true);
+            break;
+        }
+        int p = x + offsets[d];
+        residual[d][x] -= bottleneck;
+        residual[reverse(d)][p] += bottleneck;
+        if (residual[d][x] == 0) makeOrphan(x, true);
+        x = p;
+    }
+    return bottleneck;
+}
+
+void GridGraphCut::adopt() {
+    while (!orphans.empty()) {
+        int o = orphans.front();
+        orphans.pop_front();
+        int8_t side = tree[o];
+
+        // Novo pai: vizinho da mesma árvore com arco aberto e origem no terminal
+        int best = -1;
+        int32_t bestDistance = INT_MAX;
+        for (int d = 0; d < adjacency; ++d) {
+            int q = o + offsets[d];
+            if (tree[q] != side) continue;
+            bool open = side > 0 ? residual[reverse(d)][q] > 0 : residual[d][o] > 0;
+            if (!open) continue;
+
+            int32_t length = 0;
+            for (int j = q; ; ) {
+                if (timestamp[j] == time) {
+                    length += distance[j];
+                    break;
+                }
+                length++;
+                int8_t pd = parent[j];
+                if (pd == TERMINAL) {
+                    timestamp[j] = time;
+                    distance[j] = 1;
+                    break;
+                }
+                if (pd == ORPHAN) {
+                    length = INT_MAX;
+                    break;
+                }
+                j += offsets[pd];
+            }
+            if (length == INT_MAX) continue;
+
+            if (length < bestDistance) {
+                best = d;
+                bestDistance = length;
+            }
+            for (int j = q; timestamp[j] != time; j += offsets[parent[j]]) {
+                timestamp[j] = time;
+                distance[j] = length--;
+            }
+        }
+
+        if (best >= 0) {
+            parent[o] = static_cast<int8_t>(best);
+            timestamp[o] = time;
+            distance[o] = bestDistance + 1;
+            continue;
+        }
+
+        // Sem pai: o nó fica livre, filhos viram órfãos e vizinhos que podiam
+        // alcançá-lo voltam a ser ativos
+        for (int d = 0; d < adjacency; ++d) {
+            int q = o + offsets[d];
+            if (tree[q] != side) continue;
+            bool open = side > 0 ? residual[reverse(d)][q] > 0 : residual[d][o] > 0;
+            if (open) activate(q);
+            if (parent[q] == reverse(d)) makeOrphan(q, false);
+        }
+        tree[o] = 0;
+        parent[o] = NONE;
+    }
+}
+
+GridGraphCut::Result GridGraphCut::collect(int64_t flow) const {
+    Result result;
+    result.width = width;
+    result.height = height;
+    result.mask.resize(static_cast<size_t>(width) * height);
+    result.flow = flow;
+    result.augmentations = augmentations;
+    result.orphans = orphanCount;
+
+    // Capacidade original de um n-link = (resíduo de ida + resíduo de volta) / 2
+    int64_t cutCost = 0;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = (y + 1) * stride + x + 1;
+            bool object = tree[v] > 0;
+            result.mask[static_cast<size_t>(y) * width + x] = object ? 1 : 0;
+
+            if (object) {
+                if (seedSide[v] < 0) cutCost += terminalCapacity;
+                for (int d = 0; d < adjacency; ++d) {
+                    int u = v + offsets[d];
+                    if (tree[u] <= 0) cutCost += (residual[d][v] + residual[reverse(d)][u]) / 2;
+                }
+            } else if (seedSide[v] > 0) {
+                cutCost += terminalCapacity;
+            }
+        }
+    }
+    result.cutCost = cutCost;
+    return result;
+}
+
+Image GridGraphCut::Result::toImage() const {
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            image.setPixel(x, y, mask[static_cast<size_t>(y) * width + x] ? 255 : 0);
+        }
+    }
+    return image;
+}
@@ -2,6 +2,7 @@
 #include <chrono>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 // === IMPLEMENTAÇÃO DO ALGORITMO IFT BÁSICO ===
 
@@ -195,6 +196,246 @@ std::unique_ptr<IFTResult> IFTAlgorithm::runIFTToTarget(
     return result;
 }
 
+std::unique_ptr<SparseIFTResult> IFTAlgorithm::runIFTBounded(
+    const Image& image,
+    const PathCostFunction& costFunction,
+    const SeedSet& seeds,
+    double maxCost) {
+    
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    int width = image.getWidth();
+    int height = image.getHeight();
+    auto result = std::make_unique<SparseIFTResult>(width, height, maxCost);
+    
+    if (verbose) {
+        std::cout << "Executando IFT limitada por custo: maxCost = " << maxCost << std::endl;
+    }
+    
+    // Fila com remoção preguiçosa: só pixels alcançados entram (nunca Q ← I)
+    typedef std::pair<double, int> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+    
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (!image.isValidCoordinate(p.x, p.y)) {
+            throw std::out_of_range("Seed outside image bounds: " + p.toString());
+        }
+        double handicap = costFunction.getHandicap(p, seeds);
+        if (handicap <= maxCost && handicap < result->getTentativeCost(p.x, p.y)) {
+            result->update(p.x, p.y, handicap, -1, seed.label);
+            queue.push(QueueEntry(handicap, p.toLinearIndex(width)));
+        }
+    }
+    
+    static const int dx[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    static const int dy[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    int adjacency = eightConnected ? 8 : 4;
+    size_t iterations = 0;
+    
+    while (!queue.empty() && queue.top().first <= maxCost) {
+        QueueEntry entry = queue.top();
+        queue.pop();
+        
+        Pixel current = Pixel::fromLinearIndex(entry.second, width);
+        if (result->isConquered(current.x, current.y) ||
+            entry.first != result->getTentativeCost(current.x, current.y)) {
+            continue;  // entrada obsoleta
+        }
+        
+        current.intensity = image.getPixelIntensity(current.x, current.y);
+        result->markConquered(current);
+        int label = result->getLabel(current.x, current.y);
+        iterations++;
+        
+        for (int d = 0; d < adjacency; ++d) {
+            int nx = current.x + dx[d];
+            int ny = current.y + dy[d];
+            if (!image.isValidCoordinate(nx, ny) || result->isConquered(nx, ny)) continue;
+            
+            Pixel neighbor(nx, ny, image.getPixelIntensity(nx, ny));
+            double extended = costFunction.extendCost(entry.first,
+                                                      costFunction.getArcWeight(current, neighbor, image));
+            if (extended <= maxCost && extended < result->getTentativeCost(nx, ny)) {
+                result->update(nx, ny, extended, entry.second, label);
+                queue.push(QueueEntry(extended, neighbor.toLinearIndex(width)));
+            }
+        }
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.pixelsProcessed = result->getConqueredPixels().size();
+    lastStats.iterationsTotal = iterations;
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    lastStats.averageCostPerPixel = 0.0;
+    for (const Pixel& p : result->getConqueredPixels()) {
+        lastStats.averageCostPerPixel += result->getCost(p.x, p.y);
+    }
+    if (!result->getConqueredPixels().empty()) {
+        lastStats.averageCostPerPixel /= result->getConqueredPixels().size();
+    }
+    lastStats.isComplete = result->getConqueredPixels().size() == static_cast<size_t>(width) * height;
+    lastStats.isValid = true;
+    
+    if (verbose) {
+        std::cout << "Pixels conquistados: " << lastStats.pixelsProcessed
+                  << " (páginas alocadas: " << result->getAllocatedTileCount() << ")" << std::endl;
+    }
+    
+    return result;
+}
+
+std::unique_ptr<IFTResult> IFTAlgorithm::runIFTInRegion(
+    const Image& image,
+    const PathCostFunction& costFunction,
+    const SeedSet& seeds,
+    int startX, int startY, int width, int height) {
+    
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Region must have positive size: " +
+                                    std::to_string(width) + "x" + std::to_string(height));
+    }
+    if (startX < 0 || startY < 0 ||
+        startX + width > image.getWidth() || startY + height > image.getHeight()) {
+        throw std::out_of_range("Region outside image bounds: (" + std::to_string(startX) + "," +
+                                std::to_string(startY) + ") " + std::to_string(width) + "x" +
+                                std::to_string(height));
+    }
+    
+    auto startTime = std::chrono::high_resolution_clock::now();
+    
+    // Janela processada = ROI + halo, recortada à imagem
+    int x0 = std::max(0, startX - regionHalo);
+    int y0 = std::max(0, startY - regionHalo);
+    int x1 = std::min(image.getWidth(), startX + width + regionHalo);
+    int y1 = std::min(image.getHeight(), startY + height + regionHalo);
+    int windowWidth = x1 - x0;
+    int windowHeight = y1 - y0;
+    size_t windowSize = static_cast<size_t>(windowWidth) * windowHeight;
+    
+    if (verbose) {
+        std::cout << "Executando IFT na ROI (" << startX << "," << startY << ") "
+                  << width << "x" << height << ", janela " << windowWidth << "x"
+                  << windowHeight << std::endl;
+    }
+    
+    // (P, C, L) em índices locais da janela
+    std::vector<double> cost(windowSize, std::numeric_limits<double>::infinity());
+    std::vector<int> predecessor(windowSize, -1);
+    std::vector<int> label(windowSize, -1);
+    std::vector<uint8_t> conquered(windowSize, 0);
+    std::vector<uint8_t> intensity(windowSize);
+    for (int y = 0; y < windowHeight; ++y) {
+        for (int x = 0; x < windowWidth; ++x) {
+            intensity[static_cast<size_t>(y) * windowWidth + x] = image.getPixelIntensity(x0 + x, y0 + y);
+        }
+    }
+    
+    typedef std::pair<double, int> QueueEntry;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+    
+    // Só sementes dentro da janela participam
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (p.x < x0 || p.x >= x1 || p.y < y0 || p.y >= y1) continue;
+        
+        int local = (p.y - y0) * windowWidth + (p.x - x0);
+        double handicap = costFunction.getHandicap(p, seeds);
+        if (handicap < cost[local]) {
+            cost[local] = handicap;
+            label[local] = seed.label;
+            queue.push(QueueEntry(handicap, local));
+        }
+    }
+    
+    static const int dx[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    static const int dy[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    int adjacency = eightConnected ? 8 : 4;
+    size_t iterations = 0;
+    
+    while (!queue.empty()) {
+        QueueEntry entry = queue.top();
+        queue.pop();
+        
+        int local = entry.second;
+        if (conquered[local] || entry.first != cost[local]) continue;  // entrada obsoleta
+        conquered[local] = 1;
+        iterations++;
+        
+        int lx = local % windowWidth;
+        int ly = local / windowWidth;
+        Pixel current(x0 + lx, y0 + ly, intensity[local]);
+        
+        for (int d = 0; d < adjacency; ++d) {
+            int nx = lx + dx[d];
+            int ny = ly + dy[d];
+            if (nx < 0 || nx >= windowWidth || ny < 0 || ny >= windowHeight) continue;
+            
+            int neighborLocal = ny * windowWidth + nx;
+            if (conquered[neighborLocal]) continue;
+            
+            Pixel neighbor(x0 + nx, y0 + ny, intensity[neighborLocal]);
+            double extended = costFunction.extendCost(entry.first,
+                                                      costFunction.getArcWeight(current, neighbor, image));
+            if (extended < cost[neighborLocal]) {
+                cost[neighborLocal] = extended;
+                predecessor[neighborLocal] = local;
+                label[neighborLocal] = label[local];
+                queue.push(QueueEntry(extended, neighborLocal));
+            }
+        }
+    }
+    
+    // Resultado em coordenadas da imagem contendo apenas os pixels da ROI
+    auto result = std::make_unique<IFTResult>(image.getWidth(), image.getHeight());
+    auto& costMap = result->getCostMapRef();
+    costMap.reserve(static_cast<size_t>(width) * height);
+    size_t reached = 0;
+    double costSum = 0.0;
+    
+    for (int y = startY; y < startY + height; ++y) {
+        for (int x = startX; x < startX + width; ++x) {
+            int local = (y - y0) * windowWidth + (x - x0);
+            Pixel pixel(x, y, intensity[local]);
+            costMap[pixel] = cost[local];
+            if (cost[local] == std::numeric_limits<double>::infinity()) continue;
+            
+            reached++;
+            costSum += cost[local];
+            result->setLabel(pixel, label[local]);
+            int pred = predecessor[local];
+            if (pred != -1) {
+                result->setPredecessor(pixel, Pixel(x0 + pred % windowWidth, y0 + pred / windowWidth,
+                                                    intensity[pred]));
+            } else {
+                result->addSeedPixel(pixel);
+            }
+        }
+    }
+    
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.pixelsProcessed = reached;
+    lastStats.iterationsTotal = iterations;
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    lastStats.averageCostPerPixel = reached > 0 ? costSum / reached : 0.0;
+    lastStats.isComplete = reached == static_cast<size_t>(width) * height;
+    lastStats.isValid = true;
+    
+    if (verbose) {
+        std::cout << "Pixels da ROI alcançados: " << reached << " de "
+                  << static_cast<size_t>(width) * height << std::endl;
+    }
+    
+    return result;
+}
+
+void IFTAlgorithm::setRegionHalo(int halo) {
+    if (halo < 0) {
+        throw std::invalid_argument("Region halo must be non-negative: " + std::to_string(halo));
+    }
+    regionHalo = halo;
+}
+
 // === VALIDAÇÃO ===
 
 bool IFTAlgorithm::validateResult(
@@ -5,6 +5,7 @@
 #include <fstream>
 #include <climits>
 #include <sstream>
+#include <stdexcept>
 
 // === IMPLEMENTAÇÃO DOS MÉTODOS FUNDAMENTAIS (P, C, L) ===
 
@@ -273,6 +274,38 @@ void IFTResult::initializeForProcessing(const Image& image, const SeedSet& seeds
     }
 }
 
+void IFTResult::stitchRegion(const IFTResult& region) {
+    if (region.width != width || region.height != height) {
+        throw std::invalid_argument("Region result dimensions do not match: " +
+                                    std::to_string(region.width) + "x" + std::to_string(region.height));
+    }
+    
+    for (const auto& pair : region.costMap) {
+        const Pixel& pixel = pair.first;
+        costMap[pixel] = pair.second;
+        
+        auto label = region.labelMap.find(pixel);
+        if (label != region.labelMap.end()) {
+            labelMap[pixel] = label->second;
+        } else {
+            labelMap.erase(pixel);
+        }
+        
+        auto predecessor = region.predecessorMap.find(pixel);
+        if (predecessor != region.predecessorMap.end()) {
+            predecessorMap[pixel] = predecessor->second;
+        } else {
+            predecessorMap.erase(pixel);
+        }
+    }
+    
+    // Sementes: descarta as antigas da região e adiciona as novas
+    seedPixels.erase(std::remove_if(seedPixels.begin(), seedPixels.end(),
+                                    [&](const Pixel& p) { return region.costMap.count(p) > 0; }),
+                     seedPixels.end());
+    seedPixels.insert(seedPixels.end(), region.seedPixels.begin(), region.seedPixels.end());
+}
+
 // === DEBUG E VISUALIZAÇÃO ===
 
 void IFTResult::print() const {
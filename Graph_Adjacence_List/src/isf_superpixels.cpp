@@ -0,0 +1,220 @@
+#include "isf_superpixels.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+ISFSuperpixels::ISFSuperpixels(const Image& image, const PathCostFunction& costFunction,
+                               bool eightConnected, double alpha, double beta)
+    : width(image.getWidth()), height(image.getHeight()), eightConnected(eightConnected),
+      alpha(alpha), beta(beta) {
+    if (eightConnected) {
+        offsetX = {-1, 0, 1, -1, 1, -1, 0, 1};
+        offsetY = {-1, -1, -1, 0, 0, 1, 1, 1};
+    } else {
+        offsetX = {0, -1, 1, 0};
+        offsetY = {-1, 0, 0, 1};
+    }
+
+    intensity.resize(static_cast<size_t>(width) * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            intensity[static_cast<size_t>(y) * width + x] = image.getPixelIntensity(x, y);
+        }
+    }
+
+    buildArcWeights(image, costFunction);
+    forest.reset(width * height);
+    queue.reset(width * height);
+}
+
+void ISFSuperpixels::buildArcWeights(const Image& image, const PathCostFunction& costFunction) {
+    int k = static_cast<int>(offsetX.size());
+    arcWeights.assign(static_cast<size_t>(width) * height * k, std::numeric_limits<double>::infinity());
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            Pixel from(x, y, image.getPixelIntensity(x, y));
+            size_t base = (static_cast<size_t>(y) * width + x) * k;
+            for (int d = 0; d < k; ++d) {
+                int nx = x + offsetX[d];
+                int ny = y + offsetY[d];
+                if (!image.isValidCoordinate(nx, ny)) continue;
+
+                Pixel to(nx, ny, image.getPixelIntensity(nx, ny));
+                double w = costFunction.getArcWeight(from, to, image);
+                double distance = std::sqrt(static_cast<double>(offsetX[d] * offsetX[d] + offsetY[d] * offsetY[d]));
+                arcWeights[base + d] = std::pow(alpha * w, beta) + distance;
+            }
+        }
+    }
+}
+
+std::vector<int> ISFSuperpixels::gridSeeds(int superpixelCount) const {
+    // Grade regular com passo sqrt(área / k), sementes no centro das células
+    double step = std::sqrt(static_cast<double>(width) * height / superpixelCount);
+    int columns = std::max(1, static_cast<int>(std::lround(width / step)));
+    int rows = std::max(1, static_cast<int>(std::lround(height / step)));
+    columns = std::min(columns, width);
+    rows = std::min(rows, height);
+
+    std::vector<int> seeds;
+    seeds.reserve(static_cast<size_t>(rows) * columns);
+    for (int r = 0; r < rows; ++r) {
+        int y = static_cast<int>((r + 0.5) * height / rows);
+        for (int c = 0; c < columns; ++c) {
+            int x = static_cast<int>((c + 0.5) * width / columns);
+            seeds.push_back(y * width + x);
+        }
+    }
+    return seeds;
+}
+
+void ISFSuperpixels::pushSeed(int tree) {
+    int v = seedVertices[tree];
+    forest.cost[v] = 0.0;
+    forest.predecessor[v] = -1;
+    forest.root[v] = v;
+    forest.label[v] = tree + 1;
+    queue.push(v, 0.0);
+}
+
+size_t ISFSuperpixels::conquer() {
+    int k = static_cast<int>(offsetX.size());
+    size_t conquered = 0;
+
+    while (!queue.empty()) {
+        int s = queue.pop();
+        conquered++;
+        int sx = s % width;
+        int sy = s / width;
+        const double* weights = arcWeights.data() + static_cast<size_t>(s) * k;
+
+        for (int d = 0; d < k; ++d) {
+            if (weights[d] == std::numeric_limits<double>::infinity()) continue;
+            int t = (sy + offsetY[d]) * width + (sx + offsetX[d]);
+            if (forest.cost[t] <= forest.cost[s]) continue;
+
+            double extended = forest.cost[s] + weights[d];
+            if (extended < forest.cost[t] || forest.predecessor[t] == s) {
+                forest.cost[t] = extended;
+                forest.predecessor[t] = s;
+                forest.root[t] = forest.root[s];
+                forest.label[t] = forest.label[s];
+                queue.push(t, extended);
+            }
+        }
+    }
+
+    return conquered;
+}
+
+std::vector<int> ISFSuperpixels::recomputeSeeds() const {
+    size_t trees = seedVertices.size();
+    std::vector<double> sumX(trees, 0.0), sumY(trees, 0.0);
+    std::vector<int> count(trees, 0);
+
+    for (int v = 0; v < width * height; ++v) {
+        int tree = forest.label[v] - 1;
+        if (tree < 0) continue;
+        sumX[tree] += v % width;
+        sumY[tree] += v / width;
+        count[tree]++;
+    }
+
+    std::vector<int> seeds = seedVertices;
+    std::vector<double> best(trees, std::numeric_limits<double>::infinity());
+    for (int v = 0; v < width * height; ++v) {
+        int tree = forest.label[v] - 1;
+        if (tree < 0) continue;
+        double dx = v % width - sumX[tree] / count[tree];
+        double dy = v / width - sumY[tree] / count[tree];
+        double distance = dx * dx + dy * dy;
+        if (distance < best[tree]) {
+            best[tree] = distance;
+            seeds[tree] = v;
+        }
+    }
+    return seeds;
+}
+
+void ISFSuperpixels::releaseTrees(const std::vector<char>& movedLabel) {
+    int n = width * height;
+    int k = static_cast<int>(offsetX.size());
+    std::vector<char> released(n, 0);
+
+    for (int v = 0; v < n; ++v) {
+        int label = forest.label[v];
+        if (label > 0 && movedLabel[label - 1]) {
+            released[v] = 1;
+            forest.cost[v] = std::numeric_limits<double>::infinity();
+            forest.predecessor[v] = -1;
+            forest.root[v] = -1;
+            forest.label[v] = -1;
+        }
+    }
+
+    // Fronteira: pixels de árvores mantidas vizinhos de uma área liberada
+    for (int v = 0; v < n; ++v) {
+        if (!released[v]) continue;
+        const double* weights = arcWeights.data() + static_cast<size_t>(v) * k;
+        for (int d = 0; d < k; ++d) {
+            if (weights[d] == std::numeric_limits<double>::infinity()) continue;
+            int t = v + offsetY[d] * width + offsetX[d];
+            if (!released[t] && !queue.contains(t)) {
+                queue.push(t, forest.cost[t]);
+            }
+        }
+    }
+}
+
+const OptimumPathForest& ISFSuperpixels::run(int superpixelCount, int iterations) {
+    if (superpixelCount <= 0) {
+        throw std::invalid_argument("Superpixel count must be positive.");
+    }
+
+    movedSeedsPerIteration.clear();
+    conqueredPerIteration.clear();
+
+    // Primeira iteração: IFT completa a partir da grade
+    seedVertices = gridSeeds(superpixelCount);
+    forest.reset(width * height);
+    queue.clear();
+    for (int tree = 0; tree < int(seedVertices.size()); ++tree) pushSeed(tree);
+    movedSeedsPerIteration.push_back(static_cast<int>(seedVertices.size()));
+    conqueredPerIteration.push_back(conquer());
+
+    for (int iteration = 1; iteration < iterations; ++iteration) {
+        std::vector<int> seeds = recomputeSeeds();
+        std::vector<char> moved(seeds.size(), 0);
+        int movedCount = 0;
+        for (size_t tree = 0; tree < seeds.size(); ++tree) {
+            if (seeds[tree] != seedVertices[tree]) {
+                moved[tree] = 1;
+                movedCount++;
+            }
+        }
+        if (movedCount == 0) break;
+
+        // IFT diferencial: só as árvores das sementes movidas são reconquistadas
+        seedVertices = seeds;
+        releaseTrees(moved);
+        for (size_t tree = 0; tree < seeds.size(); ++tree) {
+            if (moved[tree]) pushSeed(static_cast<int>(tree));
+        }
+
+        movedSeedsPerIteration.push_back(movedCount);
+        conqueredPerIteration.push_back(conquer());
+    }
+
+    return forest;
+}
+
+SeedSet ISFSuperpixels::getSeeds() const {
+    SeedSet seeds;
+    for (size_t tree = 0; tree < seedVertices.size(); ++tree) {
+        int v = seedVertices[tree];
+        seeds.addSeed(Pixel(v % width, v / width, intensity[v]), static_cast<int>(tree) + 1);
+    }
+    return seeds;
+}
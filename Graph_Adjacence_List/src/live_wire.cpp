@@ -0,0 +1,303 @@
+#include "live_wire.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    const int TILE_BITS = 6;
+    const int TILE_SIZE = 1 << TILE_BITS;
+    const int TILE_AREA = TILE_SIZE * TILE_SIZE;
+
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    const double SQRT2 = std::sqrt(2.0);
+
+    struct OpenEntry {
+        double f;       // g + h(alvo corrente)
+        double g;       // custo com que o pixel entrou na fila
+        int v;
+    };
+
+    // Menor f no topo; em empate, maior g (aprofunda em direção ao alvo)
+    struct OpenEntryGreater {
+        bool operator()(const OpenEntry& a, const OpenEntry& b) const {
+            return a.f > b.f || (a.f == b.f && a.g < b.g);
+        }
+    };
+}
+
+// Floresta de uma âncora: (P, C) paginados + fila aberta do A*
+struct LiveWire::AnchorForest {
+    struct Tile {
+        std::array<double, TILE_AREA> cost;
+        std::array<int32_t, TILE_AREA> predecessor;
+        std::array<uint8_t, TILE_AREA> closed;
+
+        Tile() {
+            cost.fill(std::numeric_limits<double>::infinity());
+            predecessor.fill(-1);
+            closed.fill(0);
+        }
+    };
+
+    int anchor;
+    int goal;
+    int width;
+    int tilesX;
+    std::vector<std::unique_ptr<Tile>> tiles;
+    std::vector<OpenEntry> open;
+
+    AnchorForest(int anchor, int width, int height, int tilesX)
+        : anchor(anchor), goal(-1), width(width), tilesX(tilesX),
+          tiles(static_cast<size_t>(tilesX) * ((height + TILE_SIZE - 1) / TILE_SIZE)) {}
+
+    Tile* findTile(int v) const {
+        return tiles[tileIndex(v % width, v / width)].get();
+    }
+
+    Tile& tileOf(int x, int y) {
+        std::unique_ptr<Tile>& tile = tiles[tileIndex(x, y)];
+        if (!tile) tile = std::make_unique<Tile>();
+        return *tile;
+    }
+
+    int tileIndex(int x, int y) const {
+        return (y >> TILE_BITS) * tilesX + (x >> TILE_BITS);
+    }
+
+    static int offsetOf(int x, int y) {
+        return ((y & (TILE_SIZE - 1)) << TILE_BITS) | (x & (TILE_SIZE - 1));
+    }
+
+    int offsetOf(int v) const {
+        return offsetOf(v % width, v / width);
+    }
+
+    double cost(int v) const {
+        Tile* tile = findTile(v);
+        return tile ? tile->cost[offsetOf(v)] : std::numeric_limits<double>::infinity();
+    }
+
+    bool isClosed(int v) const {
+        Tile* tile = findTile(v);
+        return tile && tile->closed[offsetOf(v)];
+    }
+};
+
+void LiveWire::QueryStats::print() const {
+    std::cout << "=== LIVE-WIRE ===" << std::endl;
+    std::cout << "Floresta em cache: " << (cachedForest ? "Sim" : "Não") << std::endl;
+    std::cout << "Fila re-chaveada: " << (rekeyed ? "Sim" : "Não") << std::endl;
+    std::cout << "Pixels expandidos: " << expandedPixels << std::endl;
+    std::cout << "Comprimento do caminho: " << pathLength << std::endl;
+    std::cout << "Custo do caminho: " << pathCost << std::endl;
+    std::cout << "Tempo: " << executionTimeMs << " ms" << std::endl;
+}
+
+LiveWire::LiveWire(const Image& image, bool eightConnected, size_t cacheCapacity)
+    : image(image), eightConnected(eightConnected), cacheCapacity(cacheCapacity),
+      width(image.getWidth()), height(image.getHeight()),
+      tilesX((image.getWidth() + TILE_SIZE - 1) / TILE_SIZE), lastStats() {
+    if (cacheCapacity == 0) {
+        throw std::invalid_argument("Live-wire cache capacity must be positive");
+    }
+    computeLocalCost();
+}
+
+LiveWire::~LiveWire() = default;
+
+void LiveWire::computeLocalCost() {
+    std::vector<std::vector<uint8_t>> data = image.getRawData();
+    size_t n = static_cast<size_t>(width) * height;
+    std::vector<float> magnitude(n);
+
+    // Sobel com borda replicada, por blocos de linhas
+    Parallel::forChunks(height, Parallel::chunkCount(height, 0, 64), [&](size_t, size_t begin, size_t end) {
+        for (int y = static_cast<int>(begin); y < static_cast<int>(end); ++y) {
+            const std::vector<uint8_t>& up = data[std::max(y - 1, 0)];
+            const std::vector<uint8_t>& mid = data[y];
+            const std::vector<uint8_t>& down = data[std::min(y + 1, height - 1)];
+            for (int x = 0; x < width; ++x) {
+                int l = std::max(x - 1, 0), r = std::min(x + 1, width - 1);
+                int gx = (up[r] + 2 * mid[r] + down[r]) - (up[l] + 2 * mid[l] + down[l]);
+                int gy = (down[l] + 2 * down[x] + down[r]) - (up[l] + 2 * up[x] + up[r]);
+                magnitude[static_cast<size_t>(y) * width + x] = std::sqrt(static_cast<float>(gx * gx + gy * gy));
+            }
+        }
+    });
+
+    float maxMagnitude = 0.0f;
+    for (float m : magnitude) maxMagnitude = std::max(maxMagnitude, m);
+    float scale = maxMagnitude > 0.0f ? 255.0f / maxMagnitude : 0.0f;
+
+    localCost.resize(n);
+    Parallel::forEach(n, [&](size_t i) {
+        localCost[i] = static_cast<uint8_t>(255 - std::lround(magnitude[i] * scale));
+    });
+}
+
+double LiveWire::getLocalCost(int x, int y) const {
+    if (!image.isValidCoordinate(x, y)) {
+        throw std::out_of_range("Pixel outside image bounds: " + Pixel(x, y, 0).toString());
+    }
+    return 1.0 + localCost[static_cast<size_t>(y) * width + x];
+}
+
+int LiveWire::indexOf(const Pixel& pixel) const {
+    if (!image.isValidCoordinate(pixel.x, pixel.y)) {
+        throw std::out_of_range("Pixel outside image bounds: " + pixel.toString());
+    }
+    return pixel.y * width + pixel.x;
+}
+
+double LiveWire::heuristic(int x, int y, int goalX, int goalY) const {
+    int dx = std::abs(x - goalX);
+    int dy = std::abs(y - goalY);
+    if (!eightConnected) return dx + dy;
+    int diagonal = std::min(dx, dy);
+    return (std::max(dx, dy) - diagonal) + SQRT2 * diagonal;
+}
+
+void LiveWire::setCacheCapacity(size_t capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Live-wire cache capacity must be positive");
+    }
+    cacheCapacity = capacity;
+    while (forests.size() > cacheCapacity) {
+        forestIndex.erase(forests.back()->anchor);
+        forests.pop_back();
+    }
+}
+
+void LiveWire::clearCache() {
+    forests.clear();
+    forestIndex.clear();
+}
+
+LiveWire::AnchorForest& LiveWire::forestFor(int anchor) {
+    auto it = forestIndex.find(anchor);
+    if (it != forestIndex.end()) {
+        forests.splice(forests.begin(), forests, it->second);
+        lastStats.cachedForest = true;
+        return *forests.front();
+    }
+
+    auto forest = std::make_unique<AnchorForest>(anchor, width, height, tilesX);
+    AnchorForest::Tile& tile = forest->tileOf(anchor % width, anchor / width);
+    tile.cost[forest->offsetOf(anchor)] = 0.0;
+    forest->open.push_back({0.0, 0.0, anchor});
+
+    forests.push_front(std::move(forest));
+    forestIndex[anchor] = forests.begin();
+    while (forests.size() > cacheCapacity) {
+        forestIndex.erase(forests.back()->anchor);
+        forests.pop_back();
+    }
+
+    lastStats.cachedForest = false;
+    return *forests.front();
+}
+
+double LiveWire::expandTo(AnchorForest& forest, int goal) {
+    if (forest.isClosed(goal)) return forest.cost(goal);
+
+    OpenEntryGreater greater;
+    std::vector<OpenEntry>& open = forest.open;
+
+    // Novo alvo: descarta entradas obsoletas e recalcula f = g + h
+    if (forest.goal != goal) {
+        size_t kept = 0;
+        for (const OpenEntry& entry : open) {
+            if (forest.isClosed(entry.v) || entry.g != forest.cost(entry.v)) continue;
+            double h = heuristic(entry.v % width, entry.v / width, goal % width, goal / width);
+            open[kept++] = {entry.g + h, entry.g, entry.v};
+        }
+        open.resize(kept);
+        std::make_heap(open.begin(), open.end(), greater);
+        forest.goal = goal;
+        lastStats.rekeyed = true;
+    }
+
+    int adjacency = eightConnected ? 8 : 4;
+    int goalX = goal % width, goalY = goal / width;
+
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), greater);
+        OpenEntry entry = open.back();
+        open.pop_back();
+
+        int v = entry.v;
+        int x = v % width, y = v / width;
+        AnchorForest::Tile& tile = forest.tileOf(x, y);
+        int offset = AnchorForest::offsetOf(x, y);
+        if (tile.closed[offset] || entry.g != tile.cost[offset]) continue;  // obsoleta
+
+        tile.closed[offset] = 1;
+        lastStats.expandedPixels++;
+
+        for (int d = 0; d < adjacency; ++d) {
+            int nx = x + DX[d], ny = y + DY[d];
+            if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+            int u = ny * width + nx;
+            AnchorForest::Tile& neighborTile = forest.tileOf(nx, ny);
+            int neighborOffset = AnchorForest::offsetOf(nx, ny);
+            if (neighborTile.closed[neighborOffset]) continue;
+
+            double arc = 1.0 + localCost[u];
+            if (d >= 4) arc *= SQRT2;
+            double extended = entry.g + arc;
+            if (extended < neighborTile.cost[neighborOffset]) {
+                neighborTile.cost[neighborOffset] = extended;
+                neighborTile.predecessor[neighborOffset] = v;
+                open.push_back({extended + heuristic(nx, ny, goalX, goalY), extended, u});
+                std::push_heap(open.begin(), open.end(), greater);
+            }
+        }
+
+        // O alvo só retorna depois de relaxado: a fila segue completa para o próximo
+        if (v == goal) return entry.g;
+    }
+
+    throw std::runtime_error("Live-wire target unreachable from anchor");
+}
+
+std::vector<Pixel> LiveWire::getPath(const Pixel& anchor, const Pixel& cursor) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    int a = indexOf(anchor);
+    int goal = indexOf(cursor);
+
+    lastStats = QueryStats();
+    AnchorForest& forest = forestFor(a);
+    lastStats.pathCost = expandTo(forest, goal);
+
+    std::vector<Pixel> path;
+    for (int v = goal; v != -1; v = forest.findTile(v)->predecessor[forest.offsetOf(v)]) {
+        int x = v % width, y = v / width;
+        path.push_back(Pixel(x, y, image.getPixelIntensity(x, y)));
+    }
+    std::reverse(path.begin(), path.end());
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.pathLength = path.size();
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return path;
+}
+
+double LiveWire::getPathCost(const Pixel& anchor, const Pixel& cursor) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    int a = indexOf(anchor);
+    int goal = indexOf(cursor);
+
+    lastStats = QueryStats();
+    lastStats.pathCost = expandTo(forestFor(a), goal);
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return lastStats.pathCost;
+}
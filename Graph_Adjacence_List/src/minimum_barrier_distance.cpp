@@ -0,0 +1,212 @@
+#include "minimum_barrier_distance.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+// GCC/Clang definem __SSE2__; o MSVC não, mas todo alvo x64 tem SSE2 e em x86
+// /arch:SSE2 (padrão) define _M_IX86_FP >= 2
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define MBD_USE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+    // Sem caminho: D = INF. U/L iniciais fazem qualquer extensão a partir de um
+    // pixel não alcançado custar exatamente INF, que nunca melhora D (sem desvios)
+    const int32_t INF = 1 << 30;
+    const int32_t NO_UPPER = 1 << 29;
+    const int32_t NO_LOWER = -(1 << 29);
+
+    struct Planes {
+        std::vector<int32_t> intensity, cost, upper, lower, predecessor;
+    };
+
+    // Relaxa uma linha a partir da linha vizinha vertical. Sem dependência entre
+    // colunas: com SSE2 a linha é processada explicitamente em blocos de 4 pixels,
+    // o que não depende do nível de otimização da build. As linhas nunca se
+    // sobrepõem, o que __restrict informa ao compilador
+    bool relaxRow(const int32_t* __restrict intensity, int32_t* __restrict cost,
+                  int32_t* __restrict upper, int32_t* __restrict lower,
+                  int32_t* __restrict predecessor, const int32_t* __restrict fromUpper,
+                  const int32_t* __restrict fromLower, int32_t fromIndex, int width) {
+        int32_t changed = 0;
+        int x = 0;
+
+#ifdef MBD_USE_SSE2
+        // SSE2 não tem min/max de int32: comparação + seleção por máscara
+        __m128i changedLanes = _mm_setzero_si128();
+        __m128i index = _mm_add_epi32(_mm_set1_epi32(fromIndex), _mm_setr_epi32(0, 1, 2, 3));
+        const __m128i step = _mm_set1_epi32(4);
+        for (; x + 4 <= width; x += 4) {
+            __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(intensity + x));
+            __m128i fu = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fromUpper + x));
+            __m128i fl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(fromLower + x));
+
+            __m128i above = _mm_cmpgt_epi32(fu, value);
+            __m128i u = _mm_or_si128(_mm_and_si128(above, fu), _mm_andnot_si128(above, value));
+            __m128i below = _mm_cmplt_epi32(fl, value);
+            __m128i l = _mm_or_si128(_mm_and_si128(below, fl), _mm_andnot_si128(below, value));
+            __m128i c = _mm_sub_epi32(u, l);
+
+            __m128i* costPtr = reinterpret_cast<__m128i*>(cost + x);
+            __m128i* upperPtr = reinterpret_cast<__m128i*>(upper + x);
+            __m128i* lowerPtr = reinterpret_cast<__m128i*>(lower + x);
+            __m128i* predecessorPtr = reinterpret_cast<__m128i*>(predecessor + x);
+
+            __m128i current = _mm_loadu_si128(costPtr);
+            __m128i mask = _mm_cmplt_epi32(c, current);
+            _mm_storeu_si128(costPtr, _mm_or_si128(_mm_and_si128(mask, c), _mm_andnot_si128(mask, current)));
+            _mm_storeu_si128(upperPtr, _mm_or_si128(_mm_and_si128(mask, u),
+                                                    _mm_andnot_si128(mask, _mm_loadu_si128(upperPtr))));
+            _mm_storeu_si128(lowerPtr, _mm_or_si128(_mm_and_si128(mask, l),
+                                                    _mm_andnot_si128(mask, _mm_loadu_si128(lowerPtr))));
+            _mm_storeu_si128(predecessorPtr, _mm_or_si128(_mm_and_si128(mask, index),
+                                                          _mm_andnot_si128(mask, _mm_loadu_si128(predecessorPtr))));
+            changedLanes = _mm_or_si128(changedLanes, mask);
+            index = _mm_add_epi32(index, step);
+        }
+        changed = _mm_movemask_epi8(changedLanes);
+#endif
+
+        // Restante da linha (ou a linha toda sem SSE2): seleções por máscara
+        // (0 ou ~0) em vez de desvios
+        for (; x < width; ++x) {
+            int32_t value = intensity[x];
+            int32_t u = fromUpper[x] > value ? fromUpper[x] : value;
+            int32_t l = fromLower[x] < value ? fromLower[x] : value;
+            int32_t c = u - l;
+            int32_t mask = -static_cast<int32_t>(c < cost[x]);
+            cost[x] = (c & mask) | (cost[x] & ~mask);
+            upper[x] = (u & mask) | (upper[x] & ~mask);
+            lower[x] = (l & mask) | (lower[x] & ~mask);
+            predecessor[x] = ((fromIndex + x) & mask) | (predecessor[x] & ~mask);
+            changed |= mask;
+        }
+        return changed != 0;
+    }
+
+    bool relaxVertical(Planes& planes, size_t row, size_t from, int width) {
+        return relaxRow(&planes.intensity[row], &planes.cost[row], &planes.upper[row],
+                        &planes.lower[row], &planes.predecessor[row], &planes.upper[from],
+                        &planes.lower[from], static_cast<int32_t>(from), width);
+    }
+
+    // Relaxa a linha a partir do vizinho horizontal (step = -1: esquerda, +1: direita)
+    bool relaxHorizontal(Planes& planes, size_t row, int width, int step) {
+        bool changed = false;
+        int begin = step < 0 ? 1 : width - 2;
+        int end = step < 0 ? width : -1;
+        for (int x = begin; x != end; x -= step) {
+            size_t v = row + x;
+            size_t q = v + step;
+            int32_t u = std::max(planes.upper[q], planes.intensity[v]);
+            int32_t l = std::min(planes.lower[q], planes.intensity[v]);
+            if (u - l < planes.cost[v]) {
+                planes.cost[v] = u - l;
+                planes.upper[v] = u;
+                planes.lower[v] = l;
+                planes.predecessor[v] = static_cast<int32_t>(q);
+                changed = true;
+            }
+        }
+        return changed;
+    }
+}
+
+MinimumBarrierDistance::MinimumBarrierDistance(int maxPasses) : maxPasses(1), lastPassCount(0) {
+    setMaxPasses(maxPasses);
+}
+
+void MinimumBarrierDistance::setMaxPasses(int passes) {
+    if (passes < 1) {
+        throw std::invalid_argument("MBD needs at least one pass: " + std::to_string(passes));
+    }
+    maxPasses = passes;
+}
+
+OptimumPathForest MinimumBarrierDistance::runFromBorder(const Image& image) {
+    SeedSet border;
+    border.addBorderSeeds(image);
+    return run(image, border);
+}
+
+OptimumPathForest MinimumBarrierDistance::run(const Image& image, const SeedSet& seeds) {
+    int width = image.getWidth();
+    int height = image.getHeight();
+    size_t n = static_cast<size_t>(width) * height;
+
+    Planes planes;
+    planes.intensity.resize(n);
+    planes.cost.assign(n, INF);
+    planes.upper.assign(n, NO_UPPER);
+    planes.lower.assign(n, NO_LOWER);
+    planes.predecessor.assign(n, -1);
+
+    std::vector<std::vector<uint8_t>> data = image.getRawData();
+    for (int y = 0; y < height; ++y) {
+        std::copy(data[y].begin(), data[y].end(), planes.intensity.begin() + static_cast<size_t>(y) * width);
+    }
+
+    OptimumPathForest forest;
+    forest.reset(static_cast<int>(n));
+
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (!image.isValidCoordinate(p.x, p.y)) {
+            throw std::out_of_range("Seed outside image bounds: " + p.toString());
+        }
+        size_t v = static_cast<size_t>(p.y) * width + p.x;
+        planes.cost[v] = 0;
+        planes.upper[v] = planes.intensity[v];
+        planes.lower[v] = planes.intensity[v];
+        forest.root[v] = static_cast<int>(v);
+        forest.label[v] = seed.label;
+    }
+
+    lastPassCount = 0;
+    bool changed = true;
+    while (changed && lastPassCount < maxPasses) {
+        changed = false;
+
+        // Varredura direta: de cima e da esquerda
+        for (int y = 0; y < height; ++y) {
+            size_t row = static_cast<size_t>(y) * width;
+            if (y > 0) changed |= relaxVertical(planes, row, row - width, width);
+            changed |= relaxHorizontal(planes, row, width, -1);
+        }
+
+        // Varredura reversa: de baixo e da direita
+        for (int y = height - 1; y >= 0; --y) {
+            size_t row = static_cast<size_t>(y) * width;
+            if (y < height - 1) changed |= relaxVertical(planes, row, row + width, width);
+            changed |= relaxHorizontal(planes, row, width, 1);
+        }
+
+        lastPassCount++;
+    }
+
+    for (size_t v = 0; v < n; ++v) {
+        if (planes.cost[v] != INF) forest.cost[v] = planes.cost[v];
+        forest.predecessor[v] = planes.predecessor[v];
+    }
+    resolveRoots(forest);
+    return forest;
+}
+
+void MinimumBarrierDistance::resolveRoots(OptimumPathForest& forest) {
+    // Relaxamentos só aceitam melhora estrita e a extensão nunca reduz o custo,
+    // então os predecessores formam uma floresta (sem ciclos)
+    std::vector<int> chain;
+    for (int v = 0; v < forest.size(); ++v) {
+        int u = v;
+        while (forest.root[u] == -1 && forest.predecessor[u] != -1) {
+            chain.push_back(u);
+            u = forest.predecessor[u];
+        }
+        for (int w : chain) {
+            forest.root[w] = forest.root[u];
+            forest.label[w] = forest.label[u];
+        }
+        chain.clear();
+    }
+}
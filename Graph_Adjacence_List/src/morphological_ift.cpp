@@ -0,0 +1,181 @@
+#include "morphological_ift.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+}
+
+template <typename T>
+MorphologicalIFT<T>::MorphologicalIFT(int width, int height, bool eightConnected)
+    : width(width), height(height), eightConnected(eightConnected) {
+    if (width <= 0 || height <= 0) {
+        throw std::invalid_argument("Morphological IFT needs positive dimensions: " +
+                                    std::to_string(width) + "x" + std::to_string(height));
+    }
+}
+
+template <typename T>
+void MorphologicalIFT<T>::checkSize(const std::vector<T>& values) const {
+    if (values.size() != static_cast<size_t>(width) * height) {
+        throw std::invalid_argument("Image size does not match " + std::to_string(width) + "x" +
+                                    std::to_string(height));
+    }
+}
+
+template <typename T>
+std::vector<T> MorphologicalIFT<T>::reconstructByDilation(const std::vector<T>& marker,
+                                                          const std::vector<T>& mask) const {
+    checkSize(marker);
+    checkSize(mask);
+
+    std::vector<int32_t> values(marker.size());
+    for (size_t v = 0; v < values.size(); ++v) values[v] = std::min(marker[v], mask[v]);
+
+    propagate(values, mask, static_cast<int>(std::numeric_limits<T>::max()) + 1, true);
+    return std::vector<T>(values.begin(), values.end());
+}
+
+template <typename T>
+std::vector<T> MorphologicalIFT<T>::reconstructByErosion(const std::vector<T>& marker,
+                                                         const std::vector<T>& mask) const {
+    checkSize(marker);
+    checkSize(mask);
+
+    std::vector<int32_t> values(marker.size());
+    for (size_t v = 0; v < values.size(); ++v) values[v] = std::max(marker[v], mask[v]);
+
+    propagate(values, mask, static_cast<int>(std::numeric_limits<T>::max()) + 1, false);
+    return std::vector<T>(values.begin(), values.end());
+}
+
+template <typename T>
+int MorphologicalIFT<T>::regionalMinima(const std::vector<T>& image, std::vector<int>& labels) const {
+    checkSize(image);
+
+    // Marcador f + 1 (sem saturar: o domínio inteiro tem um nível a mais)
+    std::vector<int32_t> values(image.size());
+    for (size_t v = 0; v < values.size(); ++v) values[v] = static_cast<int32_t>(image[v]) + 1;
+
+    labels.assign(image.size(), 0);
+    return propagate(values, image, static_cast<int>(std::numeric_limits<T>::max()) + 2, false,
+                     &image, &labels);
+}
+
+template <typename T>
+int MorphologicalIFT<T>::regionalMaxima(const std::vector<T>& image, std::vector<int>& labels) const {
+    checkSize(image);
+
+    std::vector<T> inverted(image.size());
+    for (size_t v = 0; v < image.size(); ++v) inverted[v] = std::numeric_limits<T>::max() - image[v];
+    return regionalMinima(inverted, labels);
+}
+
+template <typename T>
+int MorphologicalIFT<T>::propagate(std::vector<int32_t>& values, const std::vector<T>& mask, int levels,
+                                   bool descending, const std::vector<T>* plateau,
+                                   std::vector<int>* labels) const {
+    int n = width * height;
+    int adjacency = eightConnected ? 8 : 4;
+
+    // Fila hierárquica: todos os pixels entram no nível do seu handicap
+    std::vector<std::vector<int>> buckets(levels);
+    for (int v = 0; v < n; ++v) buckets[values[v]].push_back(v);
+
+    std::vector<char> done(n, 0);
+    std::vector<int> flood;
+    int regions = 0;
+
+    for (int step = 0; step < levels; ++step) {
+        int level = descending ? levels - 1 - step : step;
+        std::vector<int>& bucket = buckets[level];
+
+        // Índice em vez de iterador: o balde corrente recebe inserções (FIFO)
+        for (size_t i = 0; i < bucket.size(); ++i) {
+            int v = bucket[i];
+            if (done[v] || values[v] != level) continue;  // entrada obsoleta
+            done[v] = 1;
+
+            int x = v % width, y = v / width;
+
+            // R(v) != f(v): v está num extremo regional; rotula o platô inteiro
+            if (plateau && values[v] != (*plateau)[v] && (*labels)[v] == 0) {
+                regions++;
+                T value = (*plateau)[v];
+                (*labels)[v] = regions;
+                flood.push_back(v);
+                while (!flood.empty()) {
+                    int p = flood.back();
+                    flood.pop_back();
+                    int px = p % width, py = p / width;
+                    for (int d = 0; d < adjacency; ++d) {
+                        int nx = px + DX[d], ny = py + DY[d];
+                        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                        int q = ny * width + nx;
+                        if ((*labels)[q] == 0 && (*plateau)[q] == value) {
+                            (*labels)[q] = regions;
+                            flood.push_back(q);
+                        }
+                    }
+                }
+            }
+
+            for (int d = 0; d < adjacency; ++d) {
+                int nx = x + DX[d], ny = y + DY[d];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+
+                int u = ny * width + nx;
+                if (done[u]) continue;
+
+                int32_t limit = mask[u];
+                if (descending) {
+                    int32_t candidate = std::min(level, limit);
+                    if (candidate > values[u]) {
+                        values[u] = candidate;
+                        buckets[candidate].push_back(u);
+                    }
+                } else {
+                    int32_t candidate = std::max(level, limit);
+                    if (candidate < values[u]) {
+                        values[u] = candidate;
+                        buckets[candidate].push_back(u);
+                    }
+                }
+            }
+        }
+
+        std::vector<int>().swap(bucket);
+    }
+
+    return regions;
+}
+
+template class MorphologicalIFT<uint8_t>;
+template class MorphologicalIFT<uint16_t>;
+
+SeedSet regionalMinimaSeeds(const Image& image, bool eightConnected) {
+    int width = image.getWidth();
+    int height = image.getHeight();
+
+    std::vector<uint8_t> values(static_cast<size_t>(width) * height);
+    std::vector<std::vector<uint8_t>> data = image.getRawData();
+    for (int y = 0; y < height; ++y) {
+        std::copy(data[y].begin(), data[y].end(), values.begin() + static_cast<size_t>(y) * width);
+    }
+
+    std::vector<int> labels;
+    MorphologicalIFT<uint8_t>(width, height, eightConnected).regionalMinima(values, labels);
+
+    SeedSet seeds;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int label = labels[static_cast<size_t>(y) * width + x];
+            if (label > 0) {
+                seeds.addSeed(image.getPixel(x, y), label, data[y][x]);
+            }
+        }
+    }
+    return seeds;
+}
@@ -0,0 +1,249 @@
+#include "multiscale_ift.h"
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <queue>
+
+namespace {
+    // Reduz a imagem pela média de blocos 2x2 (bordas ímpares usam o que existe)
+    Image downsample(const Image& image) {
+        int width = (image.getWidth() + 1) / 2;
+        int height = (image.getHeight() + 1) / 2;
+        Image reduced(width, height);
+
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int sum = 0;
+                int count = 0;
+                for (int dy = 0; dy < 2; ++dy) {
+                    for (int dx = 0; dx < 2; ++dx) {
+                        int sx = 2 * x + dx;
+                        int sy = 2 * y + dy;
+                        if (image.isValidCoordinate(sx, sy)) {
+                            sum += image.getPixelIntensity(sx, sy);
+                            count++;
+                        }
+                    }
+                }
+                reduced.setPixelValue(x, y, static_cast<uint8_t>((sum + count / 2) / count));
+            }
+        }
+        return reduced;
+    }
+}
+
+void MultiscaleIFT::LevelStats::print() const {
+    std::cout << "  Nível " << width << "x" << height << ": " << processedPixels
+              << " pixels processados" << std::endl;
+}
+
+size_t MultiscaleIFT::propagate(const Image& image, const PathCostFunction& costFunction,
+                                const std::vector<char>& free, std::vector<double>& costs,
+                                std::vector<int>& labels, IndexedMinHeap<double>& queue) const {
+    static const int dx8[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    static const int dy8[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    int width = image.getWidth();
+    int height = image.getHeight();
+    int adjacency = eightConnected ? 8 : 4;
+    size_t processed = 0;
+
+    while (!queue.empty()) {
+        int s = queue.pop();
+        int sx = s % width;
+        int sy = s / width;
+        Pixel from(sx, sy, image.getPixelIntensity(sx, sy));
+        if (free[s]) processed++;
+
+        for (int d = 0; d < adjacency; ++d) {
+            int tx = sx + dx8[d];
+            int ty = sy + dy8[d];
+            if (tx < 0 || tx >= width || ty < 0 || ty >= height) continue;
+
+            int t = ty * width + tx;
+            if (!free[t] || costs[t] <= costs[s]) continue;
+
+            Pixel to(tx, ty, image.getPixelIntensity(tx, ty));
+            double extended = costFunction.extendCost(costs[s], costFunction.getArcWeight(from, to, image));
+            if (extended < costs[t]) {
+                costs[t] = extended;
+                labels[t] = labels[s];
+                queue.push(t, extended);
+            }
+        }
+    }
+
+    return processed;
+}
+
+std::vector<char> MultiscaleIFT::boundaryBand(int width, int height, const std::vector<int>& labels) const {
+    std::vector<char> band(static_cast<size_t>(width) * height, 0);
+    std::vector<int> distance(band.size(), -1);
+    std::queue<int> frontier;
+
+    // Fronteira: rótulo diferente de algum 4-vizinho (ou pixel não conquistado)
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            int label = labels[v];
+            bool boundary = label == -1 ||
+                (x + 1 < width && labels[v + 1] != label) ||
+                (x > 0 && labels[v - 1] != label) ||
+                (y + 1 < height && labels[v + width] != label) ||
+                (y > 0 && labels[v - width] != label);
+            if (boundary) {
+                distance[v] = 0;
+                band[v] = 1;
+                frontier.push(v);
+            }
+        }
+    }
+
+    // Dilatação por BFS até bandRadius passos
+    while (!frontier.empty()) {
+        int v = frontier.front();
+        frontier.pop();
+        if (distance[v] >= bandRadius) continue;
+
+        int x = v % width;
+        int y = v / width;
+        int neighbors[4] = {x > 0 ? v - 1 : -1, x + 1 < width ? v + 1 : -1,
+                            y > 0 ? v - width : -1, y + 1 < height ? v + width : -1};
+        for (int t : neighbors) {
+            if (t != -1 && distance[t] == -1) {
+                distance[t] = distance[v] + 1;
+                band[t] = 1;
+                frontier.push(t);
+            }
+        }
+    }
+
+    return band;
+}
+
+MultiscaleIFT::Result MultiscaleIFT::run(const Image& image, const PathCostFunction& costFunction,
+                                         const SeedSet& seeds) const {
+    const double infinity = std::numeric_limits<double>::infinity();
+
+    // Pirâmide: pyramid[0] = imagem original, pyramid.back() = nível mais grosso
+    std::vector<const Image*> pyramid = {&image};
+    std::vector<std::unique_ptr<Image>> reduced;
+    while (static_cast<int>(pyramid.size()) < maxLevels &&
+           std::min(pyramid.back()->getWidth(), pyramid.back()->getHeight()) / 2 >= minLevelSize) {
+        reduced.push_back(std::make_unique<Image>(downsample(*pyramid.back())));
+        pyramid.push_back(reduced.back().get());
+    }
+
+    std::vector<Seed> activeSeeds = seeds.getActiveSeeds();
+    for (const Seed& seed : activeSeeds) {
+        if (!image.isValidCoordinate(seed.pixel.x, seed.pixel.y)) {
+            throw std::out_of_range("Seed outside image bounds: " + seed.pixel.toString());
+        }
+    }
+
+    Result result;
+    std::vector<int> labels;
+    std::vector<double> costs;
+    IndexedMinHeap<double> queue;
+
+    for (int level = static_cast<int>(pyramid.size()) - 1; level >= 0; --level) {
+        const Image& current = *pyramid[level];
+        int width = current.getWidth();
+        int height = current.getHeight();
+        size_t n = static_cast<size_t>(width) * height;
+        bool coarsest = level == static_cast<int>(pyramid.size()) - 1;
+
+        std::vector<char> free;
+        if (coarsest) {
+            labels.assign(n, -1);
+            costs.assign(n, infinity);
+            free.assign(n, 1);
+        } else {
+            // Amplia rótulos e custos do nível anterior (vizinho mais próximo)
+            int coarseWidth = pyramid[level + 1]->getWidth();
+            std::vector<int> upLabels(n);
+            std::vector<double> upCosts(n);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int c = (y / 2) * coarseWidth + x / 2;
+                    upLabels[y * width + x] = labels[c];
+                    upCosts[y * width + x] = costs[c];
+                }
+            }
+            labels.swap(upLabels);
+            costs.swap(upCosts);
+            free = boundaryBand(width, height, labels);
+
+            // A vizinhança de cada semente sempre entra na faixa: uma semente que
+            // colidiu com outra no nível grosso ainda precisa propagar seu rótulo
+            int radius = std::max(bandRadius, 1);
+            for (const Seed& seed : activeSeeds) {
+                int sx = std::min(seed.pixel.x >> level, width - 1);
+                int sy = std::min(seed.pixel.y >> level, height - 1);
+                for (int y = std::max(0, sy - radius); y <= std::min(height - 1, sy + radius); ++y) {
+                    for (int x = std::max(0, sx - radius); x <= std::min(width - 1, sx + radius); ++x) {
+                        free[static_cast<size_t>(y) * width + x] = 1;
+                    }
+                }
+            }
+        }
+
+        queue.reset(static_cast<int>(n));
+
+        // Pixels fixos vizinhos da faixa são raízes com o custo ampliado
+        if (!coarsest) {
+            for (size_t v = 0; v < n; ++v) {
+                if (free[v]) continue;
+                int x = static_cast<int>(v) % width;
+                int y = static_cast<int>(v) / width;
+                bool touchesBand = (x > 0 && free[v - 1]) || (x + 1 < width && free[v + 1]) ||
+                                   (y > 0 && free[v - width]) || (y + 1 < height && free[v + width]);
+                if (touchesBand && costs[v] < infinity) {
+                    queue.push(static_cast<int>(v), costs[v]);
+                }
+            }
+            for (size_t v = 0; v < n; ++v) {
+                if (free[v]) {
+                    costs[v] = infinity;
+                    labels[v] = -1;
+                }
+            }
+        }
+
+        // Sementes mapeadas para o nível (menor handicap vence)
+        for (const Seed& seed : activeSeeds) {
+            int x = std::min(seed.pixel.x >> level, width - 1);
+            int y = std::min(seed.pixel.y >> level, height - 1);
+            int v = y * width + x;
+            double handicap = costFunction.getHandicap(seed.pixel, seeds);
+            if (handicap < costs[v]) {
+                costs[v] = handicap;
+                labels[v] = seed.label;
+                queue.push(v, handicap);
+            }
+        }
+
+        size_t processed = propagate(current, costFunction, free, costs, labels, queue);
+        result.levels.push_back({width, height, processed});
+    }
+
+    result.width = image.getWidth();
+    result.height = image.getHeight();
+    result.labels.swap(labels);
+    result.costs.swap(costs);
+    return result;
+}
+
+std::unique_ptr<IFTResult> MultiscaleIFT::Result::toIFTResult(const Image& image) const {
+    auto ift = std::make_unique<IFTResult>(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            Pixel pixel(x, y, image.getPixelIntensity(x, y));
+            ift->setCost(pixel, costs[v]);
+            if (labels[v] != -1) {
+                ift->setLabel(pixel, labels[v]);
+            }
+        }
+    }
+    return ift;
+}
@@ -0,0 +1,256 @@
+#include "opf_classifier.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+    const float INF = std::numeric_limits<float>::infinity();
+
+    // Distância euclidiana ao quadrado
+    inline float squaredDistance(const float* a, const float* b, size_t dimensions) {
+        float sum = 0.0f;
+        for (size_t i = 0; i < dimensions; ++i) {
+            float diff = a[i] - b[i];
+            sum += diff * diff;
+        }
+        return sum;
+    }
+
+    // Menor chave de um bloco (empate: menor índice, como na versão sequencial)
+    struct Candidate {
+        float key = INF;
+        int index = -1;
+
+        void offer(float k, int i) {
+            if (index == -1 || k < key || (k == key && i < index)) {
+                key = k;
+                index = i;
+            }
+        }
+    };
+
+    Candidate bestOf(const std::vector<Candidate>& candidates) {
+        Candidate best;
+        for (const Candidate& c : candidates) {
+            if (c.index != -1) best.offer(c.key, c.index);
+        }
+        return best;
+    }
+}
+
+void OPFClassifier::ClassifyStats::print() const {
+    std::cout << "=== OPF ===" << std::endl;
+    std::cout << "Amostras: " << samples << std::endl;
+    std::cout << "Amostras de treino por consulta: " << averageVisited << std::endl;
+    std::cout << "Tempo: " << executionTimeMs << " ms" << std::endl;
+}
+
+std::vector<int> OPFClassifier::findPrototypes(const std::vector<float>& features,
+                                               const std::vector<int>& labels) const {
+    int n = static_cast<int>(labels.size());
+    std::vector<float> key(n, INF);
+    std::vector<int> parent(n, -1);
+    std::vector<char> inTree(n, 0);
+    std::vector<char> prototype(n, 0);
+
+    // Threads criadas uma vez: cada passo de Prim é uma rodada da equipe
+    size_t chunks = Parallel::chunkCount(n, threads, 1 << 12);
+    Parallel::ChunkTeam team(n, chunks);
+    std::vector<Candidate> candidates(chunks);
+
+    // Prim: cada passada atualiza as chaves pelo vértice recém-inserido e já
+    // devolve o próximo vértice (mínimo por bloco, combinado em ordem)
+    int current = 0;
+    inTree[0] = 1;
+    for (int step = 1; step < n; ++step) {
+        const float* from = &features[static_cast<size_t>(current) * dimensions];
+        team.run([&](size_t chunk, size_t begin, size_t end) {
+            Candidate best;
+            for (size_t v = begin; v < end; ++v) {
+                if (inTree[v]) continue;
+                float d = squaredDistance(from, &features[v * dimensions], dimensions);
+                if (d < key[v]) {
+                    key[v] = d;
+                    parent[v] = current;
+                }
+                best.offer(key[v], static_cast<int>(v));
+            }
+            candidates[chunk] = best;
+        });
+
+        current = bestOf(candidates).index;
+        inTree[current] = 1;
+        if (labels[current] != labels[parent[current]]) {
+            prototype[current] = 1;
+            prototype[parent[current]] = 1;
+        }
+    }
+
+    std::vector<int> result;
+    for (int v = 0; v < n; ++v) {
+        if (prototype[v]) result.push_back(v);
+    }
+    // Uma só classe: nenhuma aresta da MST separa rótulos; qualquer amostra serve
+    if (result.empty()) result.push_back(0);
+    return result;
+}
+
+void OPFClassifier::train(const std::vector<float>& features, size_t dims, const std::vector<int>& labels) {
+    if (dims == 0) {
+        throw std::invalid_argument("OPF needs at least one feature dimension");
+    }
+    if (labels.empty()) {
+        throw std::invalid_argument("OPF needs at least one training sample");
+    }
+    if (features.size() != labels.size() * dims) {
+        throw std::invalid_argument("Feature matrix size " + std::to_string(features.size()) +
+                                    " does not match " + std::to_string(labels.size()) + " x " +
+                                    std::to_string(dims));
+    }
+
+    dimensions = dims;
+    int n = static_cast<int>(labels.size());
+    prototypes = findPrototypes(features, labels);
+
+    // IFT com f_max a partir dos protótipos sobre o grafo completo
+    std::vector<float> cost(n, INF);
+    std::vector<char> done(n, 0);
+    forest.reset(n);
+    for (int p : prototypes) {
+        cost[p] = 0.0f;
+        forest.root[p] = p;
+        forest.label[p] = labels[p];
+    }
+
+    size_t chunks = Parallel::chunkCount(n, threads, 1 << 12);
+    Parallel::ChunkTeam team(n, chunks);
+    std::vector<Candidate> candidates(chunks);
+    std::vector<int> order;
+    order.reserve(n);
+
+    int current = prototypes.front();
+    for (int step = 0; step < n; ++step) {
+        done[current] = 1;
+        order.push_back(current);
+        if (step + 1 == n) break;
+
+        const float* from = &features[static_cast<size_t>(current) * dimensions];
+        float base = cost[current];
+        team.run([&](size_t chunk, size_t begin, size_t end) {
+            Candidate best;
+            for (size_t v = begin; v < end; ++v) {
+                if (done[v]) continue;
+                float c = std::max(base, squaredDistance(from, &features[v * dimensions], dimensions));
+                if (c < cost[v]) {
+                    cost[v] = c;
+                    forest.predecessor[v] = current;
+                    forest.root[v] = forest.root[current];
+                    forest.label[v] = forest.label[current];
+                }
+                best.offer(cost[v], static_cast<int>(v));
+            }
+            candidates[chunk] = best;
+        });
+        current = bestOf(candidates).index;
+    }
+
+    // Ordem de conquista = ordem crescente de custo, em blocos de BLOCK amostras
+    // com as características transpostas; o último bloco é completado com custo
+    // infinito (nunca vence)
+    size_t blocks = (n + BLOCK - 1) / BLOCK;
+    orderedFeatures.assign(blocks * BLOCK * dimensions, 0.0f);
+    orderedCost.assign(blocks * BLOCK, INF);
+    orderedLabel.assign(blocks * BLOCK, -1);
+    trainingSize = n;
+    for (int i = 0; i < n; ++i) {
+        int v = order[i];
+        float* block = &orderedFeatures[(i / BLOCK) * BLOCK * dimensions];
+        for (size_t d = 0; d < dimensions; ++d) {
+            block[d * BLOCK + i % BLOCK] = features[static_cast<size_t>(v) * dimensions + d];
+        }
+        orderedCost[i] = cost[v];
+        orderedLabel[i] = forest.label[v];
+        forest.cost[v] = std::sqrt(cost[v]);
+    }
+}
+
+int OPFClassifier::classifyOne(const float* sample, size_t& visited) const {
+    size_t blocks = orderedCost.size() / BLOCK;
+    float best = INF;
+    int label = orderedLabel[0];
+
+    // Distâncias a BLOCK amostras por vez, uma faixa SIMD por amostra; o teste
+    // de parada usa o menor custo do bloco (o primeiro)
+    size_t b = 0;
+    for (; b < blocks && orderedCost[b * BLOCK] < best; ++b) {
+        const float* block = &orderedFeatures[b * BLOCK * dimensions];
+        float distances[BLOCK] = {};
+        for (size_t d = 0; d < dimensions; ++d) {
+            float value = sample[d];
+            for (size_t j = 0; j < BLOCK; ++j) {
+                float diff = value - block[d * BLOCK + j];
+                distances[j] += diff * diff;
+            }
+        }
+        for (size_t j = 0; j < BLOCK; ++j) {
+            float c = std::max(orderedCost[b * BLOCK + j], distances[j]);
+            if (c < best) {
+                best = c;
+                label = orderedLabel[b * BLOCK + j];
+            }
+        }
+    }
+    visited += std::min(b * BLOCK, trainingSize);
+    return label;
+}
+
+int OPFClassifier::classify(const float* sample) const {
+    if (!isTrained()) {
+        throw std::runtime_error("OPFClassifier::classify called before train");
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    size_t visited = 0;
+    int label = classifyOne(sample, visited);
+    auto endTime = std::chrono::high_resolution_clock::now();
+
+    lastStats.samples = 1;
+    lastStats.averageVisited = static_cast<double>(visited);
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return label;
+}
+
+std::vector<int> OPFClassifier::classify(const std::vector<float>& features) const {
+    if (!isTrained()) {
+        throw std::runtime_error("OPFClassifier::classify called before train");
+    }
+    if (features.size() % dimensions != 0) {
+        throw std::invalid_argument("Feature matrix size " + std::to_string(features.size()) +
+                                    " is not a multiple of " + std::to_string(dimensions));
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    size_t n = features.size() / dimensions;
+    std::vector<int> labels(n);
+    size_t chunks = Parallel::chunkCount(n, threads, 1 << 10);
+    std::vector<size_t> visited(chunks, 0);
+    Parallel::forChunks(n, chunks, [&](size_t chunk, size_t begin, size_t end) {
+        for (size_t s = begin; s < end; ++s) {
+            labels[s] = classifyOne(&features[s * dimensions], visited[chunk]);
+        }
+    });
+
+    size_t total = 0;
+    for (size_t v : visited) total += v;
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.samples = n;
+    lastStats.averageVisited = n > 0 ? static_cast<double>(total) / n : 0.0;
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return labels;
+}
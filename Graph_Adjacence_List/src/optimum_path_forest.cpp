@@ -0,0 +1,53 @@
+#include "optimum_path_forest.h"
+#include <algorithm>
+#include <stdexcept>
+
+void OptimumPathForest::reset(int vertexCount) {
+    cost.assign(vertexCount, std::numeric_limits<double>::infinity());
+    predecessor.assign(vertexCount, -1);
+    root.assign(vertexCount, -1);
+    label.assign(vertexCount, -1);
+}
+
+std::vector<int> OptimumPathForest::path(int v) const {
+    std::vector<int> result;
+    if (!isConquered(v)) {
+        return result;
+    }
+
+    for (int current = v; current != -1; current = predecessor[current]) {
+        result.push_back(current);
+    }
+    std::reverse(result.begin(), result.end());
+    return result;
+}
+
+std::unique_ptr<IFTResult> OptimumPathForest::toIFTResult(const Image& image) const {
+    int width = image.getWidth();
+    int height = image.getHeight();
+    if (static_cast<long long>(width) * height != static_cast<long long>(size())) {
+        throw std::invalid_argument("Forest size does not match image dimensions.");
+    }
+
+    auto pixelAt = [&](int v) {
+        int x = v % width;
+        int y = v / width;
+        return Pixel(x, y, image.getPixelIntensity(x, y));
+    };
+
+    auto result = std::make_unique<IFTResult>(width, height);
+    for (int v = 0; v < size(); ++v) {
+        Pixel pixel = pixelAt(v);
+        result->setCost(pixel, cost[v]);
+        if (label[v] != -1) {
+            result->setLabel(pixel, label[v]);
+        }
+        if (predecessor[v] != -1) {
+            result->setPredecessor(pixel, pixelAt(predecessor[v]));
+        }
+        if (isRoot(v)) {
+            result->addSeedPixel(pixel);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,369 @@
+#include "random_walker.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+
+// Condutâncias brutas (sem moldura) e coluna de cada semente (-1 = livre);
+// assemble monta a grade com moldura de 1 pixel usada pelo CG: acoplamentos
+// para a moldura e para sementes são 0 (a condutância entra só no grau), então
+// nenhum laço testa limites
+struct RandomWalker::Grid {
+    int width, height, stride;
+    size_t size;
+    std::vector<float> rawEast, rawSouth;   // [y * width + x]
+    std::vector<int> seedColumn;            // [y * width + x]
+
+    std::vector<float> east, south;         // acoplamento v -> v + 1 e v -> v + stride
+    std::vector<double> diagonal;           // grau; 0 em sementes e na moldura
+    std::vector<double> inverseDiagonal;    // pré-condicionador de Jacobi
+    std::vector<double> rhs;                // -B M, intercalado [v * C + k]
+
+    Grid(int width, int height)
+        : width(width), height(height), stride(width + 2),
+          size(static_cast<size_t>(width + 2) * (height + 2)),
+          rawEast(static_cast<size_t>(width) * height, 0.0f),
+          rawSouth(static_cast<size_t>(width) * height, 0.0f),
+          seedColumn(static_cast<size_t>(width) * height, -1) {}
+
+    size_t index(int x, int y) const { return static_cast<size_t>(y + 1) * stride + x + 1; }
+
+    void assemble(int columns);
+};
+
+void RandomWalker::Grid::assemble(int columns) {
+    east.assign(size, 0.0f);
+    south.assign(size, 0.0f);
+    // Grau em double: em float, arestas de 1e-6 somem ao lado de arestas ~1
+    diagonal.assign(size, 0.0);
+    inverseDiagonal.assign(size, 0.0);
+    rhs.assign(size * columns, 0.0);
+
+    // Aresta v-u: soma no grau dos dois; acoplamento só entre livres;
+    // livre ao lado de semente recebe w * m(semente) no lado direito
+    auto addEdge = [&](size_t v, size_t u, int kv, int ku, float w, float& coupling) {
+        diagonal[v] += w;
+        diagonal[u] += w;
+        if (kv < 0 && ku < 0) {
+            coupling = w;
+        } else if (kv < 0 && ku < columns) {
+            rhs[v * columns + ku] += w;
+        } else if (ku < 0 && kv < columns) {
+            rhs[u * columns + kv] += w;
+        }
+    };
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            size_t raw = static_cast<size_t>(y) * width + x;
+            size_t v = index(x, y);
+            if (x + 1 < width) {
+                addEdge(v, v + 1, seedColumn[raw], seedColumn[raw + 1], rawEast[raw], east[v]);
+            }
+            if (y + 1 < height) {
+                addEdge(v, v + stride, seedColumn[raw], seedColumn[raw + width], rawSouth[raw], south[v]);
+            }
+        }
+    }
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            size_t v = index(x, y);
+            if (seedColumn[static_cast<size_t>(y) * width + x] >= 0 || diagonal[v] == 0.0) {
+                diagonal[v] = 0.0;
+            } else {
+                inverseDiagonal[v] = 1.0 / diagonal[v];
+            }
+        }
+    }
+}
+
+RandomWalker::RandomWalker(double beta, int maxIterations, double tolerance)
+    : RandomWalker(std::make_unique<IntensityDifferenceWeight>(), beta, maxIterations, tolerance) {}
+
+RandomWalker::RandomWalker(std::unique_ptr<ArcWeightStrategy> strategy, double beta,
+                           int maxIterations, double tolerance)
+    : strategy(std::move(strategy)), beta(90.0), maxIterations(2000), tolerance(1e-4), threads(0) {
+    if (!this->strategy) {
+        throw std::invalid_argument("RandomWalker needs an arc weight strategy");
+    }
+    setBeta(beta);
+    setMaxIterations(maxIterations);
+    setTolerance(tolerance);
+}
+
+void RandomWalker::setBeta(double value) {
+    if (value < 0.0) {
+        throw std::invalid_argument("Random walker beta must be non-negative: " + std::to_string(value));
+    }
+    beta = value;
+}
+
+void RandomWalker::setMaxIterations(int value) {
+    if (value < 1) {
+        throw std::invalid_argument("Random walker needs at least one iteration: " + std::to_string(value));
+    }
+    maxIterations = value;
+}
+
+void RandomWalker::setTolerance(double value) {
+    if (value <= 0.0) {
+        throw std::invalid_argument("Random walker tolerance must be positive: " + std::to_string(value));
+    }
+    tolerance = value;
+}
+
+std::vector<float> RandomWalker::conductanceTable(const Image& image) const {
+    std::vector<double> weights(256 * 256);
+    double maxWeight = 0.0;
+    for (int a = 0; a < 256; ++a) {
+        for (int b = 0; b < 256; ++b) {
+            double w = strategy->computeWeight(Pixel(0, 0, static_cast<uint8_t>(a)),
+                                               Pixel(1, 0, static_cast<uint8_t>(b)), image);
+            weights[a * 256 + b] = w;
+            maxWeight = std::max(maxWeight, w);
+        }
+    }
+    if (maxWeight <= 0.0) maxWeight = 1.0;
+
+    std::vector<float> table(256 * 256);
+    for (size_t i = 0; i < table.size(); ++i) {
+        double d = weights[i] / maxWeight;
+        table[i] = static_cast<float>(std::exp(-beta * d * d) + 1e-6);
+    }
+    return table;
+}
+
+RandomWalker::Result RandomWalker::run(const Image& image, const SeedSet& seeds) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int width = image.getWidth();
+    int height = image.getHeight();
+    size_t n = static_cast<size_t>(width) * height;
+
+    std::vector<Seed> active = seeds.getActiveSeeds();
+    std::set<int> distinct;
+    for (const Seed& seed : active) {
+        if (!image.isValidCoordinate(seed.pixel.x, seed.pixel.y)) {
+            throw std::out_of_range("Seed outside image bounds: " + seed.pixel.toString());
+        }
+        distinct.insert(seed.label);
+    }
+    if (distinct.empty()) {
+        throw std::invalid_argument("Random walker needs at least one seed");
+    }
+
+    Result result;
+    result.width = width;
+    result.height = height;
+    result.labelValues.assign(distinct.begin(), distinct.end());
+    result.iterations = 0;
+    result.relativeResidual = 0.0;
+
+    int labelCount = static_cast<int>(result.labelValues.size());
+    int columns = labelCount - 1;
+
+    Grid grid(width, height);
+    for (const Seed& seed : active) {
+        int k = static_cast<int>(std::lower_bound(result.labelValues.begin(), result.labelValues.end(),
+                                                  seed.label) - result.labelValues.begin());
+        grid.seedColumn[static_cast<size_t>(seed.pixel.y) * width + seed.pixel.x] = k;
+    }
+
+    std::vector<double> x;
+    if (columns > 0) {
+        std::vector<float> table = conductanceTable(image);
+        std::vector<std::vector<uint8_t>> data = image.getRawData();
+        for (int y = 0; y < height; ++y) {
+            for (int col = 0; col < width; ++col) {
+                size_t raw = static_cast<size_t>(y) * width + col;
+                if (col + 1 < width) grid.rawEast[raw] = table[data[y][col] * 256 + data[y][col + 1]];
+                if (y + 1 < height) grid.rawSouth[raw] = table[data[y][col] * 256 + data[y + 1][col]];
+            }
+        }
+        grid.assemble(columns);
+
+        x.assign(grid.size * columns, 0.0);
+        result.iterations = solve(grid, columns, x, result.relativeResidual);
+    }
+
+    // Probabilidades completas (última coluna = 1 - soma) e rótulo mais provável
+    result.probabilities.assign(n * labelCount, 0.0f);
+    result.labels.assign(n, result.labelValues[0]);
+    for (int y = 0; y < height; ++y) {
+        for (int col = 0; col < width; ++col) {
+            size_t v = grid.index(col, y);
+            size_t out = static_cast<size_t>(y) * width + col;
+            float* prob = &result.probabilities[out * labelCount];
+
+            if (grid.seedColumn[out] >= 0) {
+                prob[grid.seedColumn[out]] = 1.0f;
+            } else {
+                float rest = 1.0f;
+                for (int k = 0; k < columns; ++k) {
+                    prob[k] = static_cast<float>(std::min(1.0, std::max(0.0, x[v * columns + k])));
+                    rest -= prob[k];
+                }
+                prob[columns] = std::max(0.0f, rest);
+            }
+
+            int best = 0;
+            for (int k = 1; k < labelCount; ++k) {
+                if (prob[k] > prob[best]) best = k;
+            }
+            result.labels[out] = result.labelValues[best];
+        }
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+int RandomWalker::solve(const Grid& grid, int columns, std::vector<double>& x, double& residual) const {
+    switch (columns) {
+        case 1: return solveColumns<1>(grid, columns, x, residual);
+        case 2: return solveColumns<2>(grid, columns, x, residual);
+        case 3: return solveColumns<3>(grid, columns, x, residual);
+        case 4: return solveColumns<4>(grid, columns, x, residual);
+        default: return solveColumns<0>(grid, columns, x, residual);
+    }
+}
+
+template <int C>
+int RandomWalker::solveColumns(const Grid& grid, int columns, std::vector<double>& x, double& residual) const {
+    // C > 0: número de colunas conhecido em compilação (laço de rótulos desenrolado)
+    const int c = C > 0 ? C : columns;
+    const int width = grid.width;
+    const size_t stride = grid.stride;
+
+    std::vector<double> r(grid.size * c, 0.0);
+    std::vector<double> p(grid.size * c, 0.0);
+    std::vector<double> q(grid.size * c, 0.0);
+
+    // Threads criadas uma vez para o solve inteiro (três passadas por iteração)
+    size_t chunks = Parallel::chunkCount(grid.height, threads, 16);
+    Parallel::ChunkTeam team(grid.height, chunks);
+    std::vector<double> partial(chunks * 2 * c);
+
+    // Passada por linhas; fn(linha, acumuladores) soma em acc[0..2c)
+    auto rows = [&](auto fn, std::vector<double>& sums) {
+        std::fill(partial.begin(), partial.end(), 0.0);
+        team.run([&](size_t chunk, size_t begin, size_t end) {
+            double* acc = &partial[chunk * 2 * c];
+            for (size_t y = begin; y < end; ++y) fn((y + 1) * stride + 1, acc);
+        });
+        sums.assign(2 * c, 0.0);
+        for (size_t chunk = 0; chunk < chunks; ++chunk) {
+            for (int k = 0; k < 2 * c; ++k) sums[k] += partial[chunk * 2 * c + k];
+        }
+    };
+
+    const float* east = grid.east.data();
+    const float* south = grid.south.data();
+    const double* diagonal = grid.diagonal.data();
+    const double* inverse = grid.inverseDiagonal.data();
+
+    // r = b (x = 0), z = M^-1 r e p = z; r.z e ||b||^2 por coluna
+    std::vector<double> sums;
+    rows([&](size_t row, double* acc) {
+        for (int col = 0; col < width; ++col) {
+            size_t v = row + col;
+            for (int k = 0; k < c; ++k) {
+                double rv = grid.rhs[v * c + k];
+                double z = rv * inverse[v];
+                r[v * c + k] = rv;
+                p[v * c + k] = z;
+                acc[k] += rv * z;
+                acc[c + k] += rv * rv;
+            }
+        }
+    }, sums);
+    std::vector<double> rz(sums.begin(), sums.begin() + c);
+    std::vector<double> bNorm(sums.begin() + c, sums.end());
+
+    std::vector<double> alpha(c), beta(c);
+    double worst = 0.0;
+    int iteration = 0;
+    for (int k = 0; k < c; ++k) {
+        if (bNorm[k] > 0.0) worst = 1.0;
+    }
+
+    while (worst > tolerance && iteration < maxIterations) {
+        iteration++;
+
+        // q = A p (sem matriz) e p.q
+        rows([&](size_t row, double* acc) {
+            for (int col = 0; col < width; ++col) {
+                size_t v = row + col;
+                double we = east[v], ww = east[v - 1], ws = south[v], wn = south[v - stride];
+                double d = diagonal[v];
+                for (int k = 0; k < c; ++k) {
+                    double value = d * p[v * c + k]
+                                - we * p[(v + 1) * c + k] - ww * p[(v - 1) * c + k]
+                                - ws * p[(v + stride) * c + k] - wn * p[(v - stride) * c + k];
+                    q[v * c + k] = value;
+                    acc[k] += p[v * c + k] * value;
+                }
+            }
+        }, sums);
+        for (int k = 0; k < c; ++k) {
+            alpha[k] = sums[k] > 0.0 ? rz[k] / sums[k] : 0.0;
+        }
+
+        // x += alpha p, r -= alpha q, z = M^-1 r (guardado em q), r.z e ||r||^2
+        rows([&](size_t row, double* acc) {
+            for (int col = 0; col < width; ++col) {
+                size_t v = row + col;
+                double inv = inverse[v];
+                for (int k = 0; k < c; ++k) {
+                    size_t i = v * c + k;
+                    x[i] += alpha[k] * p[i];
+                    double rv = r[i] - alpha[k] * q[i];
+                    r[i] = rv;
+                    double z = rv * inv;
+                    q[i] = z;
+                    acc[k] += rv * z;
+                    acc[c + k] += rv * rv;
+                }
+            }
+        }, sums);
+
+        worst = 0.0;
+        for (int k = 0; k < c; ++k) {
+            if (bNorm[k] > 0.0) worst = std::max(worst, std::sqrt(sums[c + k] / bNorm[k]));
+            beta[k] = rz[k] > 0.0 ? sums[k] / rz[k] : 0.0;
+            rz[k] = sums[k];
+        }
+        if (worst <= tolerance) break;
+
+        // p = z + beta p
+        team.run([&](size_t, size_t begin, size_t end) {
+            for (size_t y = begin; y < end; ++y) {
+                size_t from = ((y + 1) * stride + 1) * c;
+                size_t to = from + static_cast<size_t>(width) * c;
+                for (size_t i = from; i < to; i += c) {
+                    for (int k = 0; k < c; ++k) p[i + k] = q[i + k] + beta[k] * p[i + k];
+                }
+            }
+        });
+    }
+
+    residual = worst;
+    return iteration;
+}
+
+std::unique_ptr<IFTResult> RandomWalker::Result::toIFTResult(const Image& image) const {
+    auto ift = std::make_unique<IFTResult>(width, height);
+    size_t labelCount = labelValues.size();
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            size_t v = static_cast<size_t>(y) * width + x;
+            size_t best = std::find(labelValues.begin(), labelValues.end(), labels[v]) - labelValues.begin();
+            Pixel pixel(x, y, image.getPixelIntensity(x, y));
+            ift->setCost(pixel, 1.0 - probabilities[v * labelCount + best]);
+            ift->setLabel(pixel, labels[v]);
+        }
+    }
+    return ift;
+}
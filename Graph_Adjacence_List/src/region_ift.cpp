@@ -0,0 +1,63 @@
+#include "region_ift.h"
+#include "utils/parallel.h"
+#include <stdexcept>
+
+RegionIFT::RegionIFT(const RegionAdjacencyGraph& rag, const std::vector<int>& labels,
+                     int width, int height)
+    : width(width), height(height), pixelRegion(labels), engine(rag.getCSR()) {
+    if (static_cast<long long>(width) * height != static_cast<long long>(labels.size())) {
+        throw std::invalid_argument("Label count does not match image dimensions.");
+    }
+    for (int region : labels) {
+        if (region < 0 || region >= getRegionCount()) {
+            throw std::invalid_argument("Pixel label is not a region of the adjacency graph.");
+        }
+    }
+}
+
+void RegionIFT::run(const PathCostFunction& costFunction, const SeedSet& seeds) {
+    // Cada semente vira uma semente de região; o motor mantém a de menor handicap
+    regionSeeds.clear();
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        int x = seed.pixel.x;
+        int y = seed.pixel.y;
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            throw std::out_of_range("Seed outside image bounds: " + seed.pixel.toString());
+        }
+        regionSeeds.emplace_back(regionOf(x, y), seed.label, costFunction.getHandicap(seed.pixel, seeds));
+    }
+
+    engine.run(costFunction, regionSeeds);
+}
+
+std::vector<int> RegionIFT::projectLabels() const {
+    std::vector<int> result(pixelRegion.size());
+    Parallel::forEach(pixelRegion.size(), [&](size_t i) { result[i] = engine.getForest().label[pixelRegion[i]]; });
+    return result;
+}
+
+std::vector<double> RegionIFT::projectCosts() const {
+    std::vector<double> result(pixelRegion.size());
+    Parallel::forEach(pixelRegion.size(), [&](size_t i) { result[i] = engine.getForest().cost[pixelRegion[i]]; });
+    return result;
+}
+
+std::unique_ptr<IFTResult> RegionIFT::toIFTResult(const Image& image) const {
+    if (image.getWidth() != width || image.getHeight() != height) {
+        throw std::invalid_argument("Image dimensions do not match the region labels.");
+    }
+
+    const OptimumPathForest& forest = engine.getForest();
+    auto result = std::make_unique<IFTResult>(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int region = regionOf(x, y);
+            Pixel pixel(x, y, image.getPixelIntensity(x, y));
+            result->setCost(pixel, forest.cost[region]);
+            if (forest.label[region] != -1) {
+                result->setLabel(pixel, forest.label[region]);
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,90 @@
+#include "sparse_ift_result.h"
+#include <algorithm>
+#include <stdexcept>
+
+SparseIFTResult::Tile::Tile() {
+    cost.fill(std::numeric_limits<double>::infinity());
+    predecessor.fill(-1);
+    label.fill(-1);
+    conquered.fill(0);
+}
+
+SparseIFTResult::SparseIFTResult(int width, int height, double maxCost)
+    : width(width), height(height),
+      tilesX((width + TILE_SIZE - 1) / TILE_SIZE), tilesY((height + TILE_SIZE - 1) / TILE_SIZE),
+      maxCost(maxCost), tiles(static_cast<size_t>(tilesX) * tilesY), allocatedTiles(0) {}
+
+double SparseIFTResult::getCost(int x, int y) const {
+    Tile* tile = findTile(x, y);
+    int i = offsetInTile(x, y);
+    return tile && tile->conquered[i] ? tile->cost[i] : std::numeric_limits<double>::infinity();
+}
+
+int SparseIFTResult::getLabel(int x, int y) const {
+    Tile* tile = findTile(x, y);
+    int i = offsetInTile(x, y);
+    return tile && tile->conquered[i] ? tile->label[i] : -1;
+}
+
+bool SparseIFTResult::isConquered(int x, int y) const {
+    Tile* tile = findTile(x, y);
+    return tile && tile->conquered[offsetInTile(x, y)];
+}
+
+bool SparseIFTResult::hasPredecessor(int x, int y) const {
+    Tile* tile = findTile(x, y);
+    int i = offsetInTile(x, y);
+    return tile && tile->conquered[i] && tile->predecessor[i] != -1;
+}
+
+Pixel SparseIFTResult::getPredecessor(int x, int y) const {
+    if (!hasPredecessor(x, y)) {
+        throw std::runtime_error("Pixel has no predecessor: " + Pixel(x, y, 0).toString());
+    }
+    return Pixel::fromLinearIndex(findTile(x, y)->predecessor[offsetInTile(x, y)], width);
+}
+
+double SparseIFTResult::getTentativeCost(int x, int y) const {
+    Tile* tile = findTile(x, y);
+    return tile ? tile->cost[offsetInTile(x, y)] : std::numeric_limits<double>::infinity();
+}
+
+size_t SparseIFTResult::memoryBytes() const {
+    return allocatedTiles * sizeof(Tile) + tiles.size() * sizeof(std::unique_ptr<Tile>) +
+           conqueredPixels.capacity() * sizeof(Pixel);
+}
+
+void SparseIFTResult::update(int x, int y, double cost, int predecessorIndex, int label) {
+    std::unique_ptr<Tile>& tile = tiles[(y >> TILE_BITS) * tilesX + (x >> TILE_BITS)];
+    if (!tile) {
+        tile = std::make_unique<Tile>();
+        allocatedTiles++;
+    }
+
+    int i = offsetInTile(x, y);
+    tile->cost[i] = cost;
+    tile->predecessor[i] = predecessorIndex;
+    tile->label[i] = label;
+}
+
+void SparseIFTResult::markConquered(const Pixel& pixel) {
+    findTile(pixel.x, pixel.y)->conquered[offsetInTile(pixel.x, pixel.y)] = 1;
+    conqueredPixels.push_back(pixel);
+}
+
+std::unique_ptr<IFTResult> SparseIFTResult::toIFTResult(const Image& image) const {
+    auto result = std::make_unique<IFTResult>(width, height);
+    for (const Pixel& pixel : conqueredPixels) {
+        const Tile* tile = findTile(pixel.x, pixel.y);
+        int i = offsetInTile(pixel.x, pixel.y);
+        result->setCost(pixel, tile->cost[i]);
+        result->setLabel(pixel, tile->label[i]);
+        if (tile->predecessor[i] != -1) {
+            Pixel p = Pixel::fromLinearIndex(tile->predecessor[i], width);
+            result->setPredecessor(pixel, image.getPixel(p.x, p.y));
+        } else {
+            result->addSeedPixel(pixel);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,138 @@
+#include "utils/concurrent_union_find.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+ConcurrentUnionFind::ConcurrentUnionFind(int n) : words(n < 0 ? 0 : n), diffs(n < 0 ? 0 : n) {
+    if (n < 0) {
+        throw std::invalid_argument("Element count cannot be negative.");
+    }
+
+    Parallel::forEach(words.size(), [&](size_t i) {
+        words[i].store(makeRoot(1), std::memory_order_relaxed);
+        diffs[i].store(0.0, std::memory_order_relaxed);
+    });
+}
+
+int ConcurrentUnionFind::find(int u) {
+    // Path splitting: cada nó visitado passa a apontar para o avô.
+    // Falhas de CAS são ignoradas: outra thread já encurtou o caminho.
+    while (true) {
+        uint64_t word = words[u].load(std::memory_order_acquire);
+        if (isRoot(word)) return u;
+
+        int parent = parentOf(word);
+        uint64_t parentWord = words[parent].load(std::memory_order_acquire);
+        if (isRoot(parentWord)) return parent;
+
+        int grandparent = parentOf(parentWord);
+        words[u].compare_exchange_weak(word, makeParent(grandparent),
+                                       std::memory_order_release, std::memory_order_relaxed);
+        u = parent;
+    }
+}
+
+bool ConcurrentUnionFind::sameSet(int u, int v) {
+    while (true) {
+        int ru = find(u);
+        int rv = find(v);
+        if (ru == rv) return true;
+        // Se ru ainda é raiz, os conjuntos eram distintos neste instante
+        if (isRoot(words[ru].load(std::memory_order_acquire))) return false;
+    }
+}
+
+uint64_t ConcurrentUnionFind::rootWord(int u, int& root, double& diff) {
+    while (true) {
+        root = find(u);
+        uint64_t word = words[root].load(std::memory_order_acquire);
+        if (!isRoot(word)) continue;
+        if (isMerging(word)) {
+            std::this_thread::yield();
+            continue;
+        }
+        // Toda ligação muda o tamanho: palavra igual antes e depois do diff
+        // garante que o diff é o dessa palavra
+        diff = diffs[root].load(std::memory_order_acquire);
+        if (words[root].load(std::memory_order_acquire) == word) return word;
+    }
+}
+
+bool ConcurrentUnionFind::link(int hi, uint64_t hiWord, int lo, uint64_t loWord, double mergedDiff) {
+    // Marca lo como em fusão; a CAS falha se lo mudou desde a leitura
+    if (!words[lo].compare_exchange_strong(loWord, loWord | MERGING_FLAG,
+                                           std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return false;
+    }
+
+    if (!words[hi].compare_exchange_strong(hiWord, makeParent(lo),
+                                           std::memory_order_acq_rel, std::memory_order_acquire)) {
+        words[lo].store(loWord, std::memory_order_release);
+        return false;
+    }
+
+    // Ninguém altera lo enquanto marcada, e hi deixou de ser raiz sem estar
+    // marcada: os dois diffs são os do momento da ligação
+    double diff = std::max(mergedDiff, std::max(diffs[lo].load(std::memory_order_acquire),
+                                                diffs[hi].load(std::memory_order_acquire)));
+    diffs[lo].store(diff, std::memory_order_release);
+    words[lo].store(makeRoot(sizeOf(loWord) + sizeOf(hiWord)), std::memory_order_release);
+    return true;
+}
+
+bool ConcurrentUnionFind::unite(int u, int v) {
+    while (true) {
+        int ru, rv;
+        double diffU, diffV;
+        uint64_t wordU = rootWord(u, ru, diffU);
+        uint64_t wordV = rootWord(v, rv, diffV);
+        if (ru == rv) return false;
+
+        // Ligação por ordem de índice: a raiz de maior índice aponta para a menor
+        if (ru > rv) {
+            if (link(ru, wordU, rv, wordV, 0.0)) return true;
+        } else {
+            if (link(rv, wordV, ru, wordU, 0.0)) return true;
+        }
+    }
+}
+
+bool ConcurrentUnionFind::join(int u, int v, double weight, double k) {
+    while (true) {
+        int ru, rv;
+        double diffU, diffV;
+        uint64_t wordU = rootWord(u, ru, diffU);
+        uint64_t wordV = rootWord(v, rv, diffV);
+        if (ru == rv) return false;
+
+        double minInternal = std::min(diffU + k / sizeOf(wordU), diffV + k / sizeOf(wordV));
+        if (weight > minInternal) {
+            // A rejeição só vale se as duas raízes ainda são as lidas
+            if (words[ru].load(std::memory_order_acquire) == wordU &&
+                words[rv].load(std::memory_order_acquire) == wordV) {
+                return false;
+            }
+            continue;
+        }
+
+        if (ru > rv) {
+            if (link(ru, wordU, rv, wordV, weight)) return true;
+        } else {
+            if (link(rv, wordV, ru, wordU, weight)) return true;
+        }
+    }
+}
+
+int ConcurrentUnionFind::getSize(int u) {
+    int root;
+    double diff;
+    return static_cast<int>(sizeOf(rootWord(u, root, diff)));
+}
+
+double ConcurrentUnionFind::getInternalDiff(int u) {
+    int root;
+    double diff;
+    rootWord(u, root, diff);
+    return diff;
+}
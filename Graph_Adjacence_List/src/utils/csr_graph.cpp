@@ -0,0 +1,87 @@
+#include "utils/csr_graph.h"
+#include <stdexcept>
+#include <string>
+
+CSRGraph CSRGraph::fromEdgeList(int vertexCount, const std::vector<std::tuple<double, int, int>>& edges) {
+    if (vertexCount < 0) {
+        throw std::invalid_argument("Vertex count must be non-negative.");
+    }
+
+    CSRGraph csr;
+    csr.offsets.assign(vertexCount + 1, 0);
+
+    // Contagem de grau, prefixo e preenchimento (counting sort estável por origem)
+    for (const auto& edge : edges) {
+        int u = std::get<1>(edge);
+        int v = std::get<2>(edge);
+        if (u < 0 || u >= vertexCount || v < 0 || v >= vertexCount) {
+            throw std::invalid_argument("Edge endpoint out of range.");
+        }
+        csr.offsets[u + 1]++;
+        csr.offsets[v + 1]++;
+    }
+    for (int u = 0; u < vertexCount; u++) csr.offsets[u + 1] += csr.offsets[u];
+
+    size_t arcs = csr.offsets[vertexCount];
+    csr.targets.resize(arcs);
+    csr.weights.resize(arcs);
+    csr.edgeIds.resize(arcs);
+
+    std::vector<int> next(csr.offsets.begin(), csr.offsets.end() - 1);
+    for (size_t i = 0; i < edges.size(); i++) {
+        double w = std::get<0>(edges[i]);
+        int u = std::get<1>(edges[i]);
+        int v = std::get<2>(edges[i]);
+
+        int a = next[u]++;
+        csr.targets[a] = v;
+        csr.weights[a] = w;
+        csr.edgeIds[a] = static_cast<int>(i);
+
+        int b = next[v]++;
+        csr.targets[b] = u;
+        csr.weights[b] = w;
+        csr.edgeIds[b] = static_cast<int>(i);
+    }
+
+    return csr;
+}
+
+CSRGraph CSRGraph::fromGraph(UndirectedGraph& graph) {
+    return fromEdgeList(static_cast<int>(graph.getVertices().size()), graph.getEdgeList());
+}
+
+CSRGraph CSRGraph::fromAdjacency(Graph& graph) {
+    const std::vector<Vertex>& vertices = graph.getVertices();
+    int n = static_cast<int>(vertices.size());
+
+    CSRGraph csr;
+    csr.offsets.assign(n + 1, 0);
+    for (int u = 0; u < n; u++) {
+        if (vertices[u].active) {
+            for (const Edge& e : graph.getNeighborsInternal(u)) {
+                csr.targets.push_back(e.to);
+                csr.weights.push_back(e.weight);
+            }
+        }
+        csr.offsets[u + 1] = static_cast<int>(csr.targets.size());
+    }
+
+    csr.edgeIds.resize(csr.targets.size());
+    for (size_t a = 0; a < csr.edgeIds.size(); a++) csr.edgeIds[a] = static_cast<int>(a);
+    return csr;
+}
+
+void CSRGraph::toUndirectedGraph(UndirectedGraph& graph) const {
+    int n = getVertexCount();
+    for (int u = 0; u < n; u++) {
+        graph.addVertex(std::to_string(u));
+    }
+    for (int u = 0; u < n; u++) {
+        for (int a = offsets[u]; a < offsets[u + 1]; a++) {
+            if (u < targets[a]) {
+                graph.addEdge(std::to_string(u), std::to_string(targets[a]), weights[a]);
+            }
+        }
+    }
+}
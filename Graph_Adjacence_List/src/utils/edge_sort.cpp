@@ -0,0 +1,172 @@
+#include "utils/edge_sort.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    const int DIGIT_BITS = 11;                 // 2048 buckets por passada
+    const size_t DIGIT_COUNT = size_t(1) << DIGIT_BITS;
+
+    enum class KeyMode { Integer, SquaredInteger };
+
+    // Converte um peso em chave conforme o modo; false se não houver chave exata
+    bool toKey(double weight, KeyMode mode, uint32_t& key) {
+        if (!(weight >= 0.0)) return false;  // também rejeita NaN
+
+        if (mode == KeyMode::Integer) {
+            if (weight > std::numeric_limits<uint32_t>::max() || weight != std::floor(weight)) return false;
+            key = static_cast<uint32_t>(weight);
+            return true;
+        }
+
+        // rgbDistance = sqrt(inteiro): weight² arredondado recupera o inteiro exato
+        double squared = std::round(weight * weight);
+        if (squared > std::numeric_limits<uint32_t>::max()) return false;
+        if (std::sqrt(squared) != weight) return false;
+        key = static_cast<uint32_t>(squared);
+        return true;
+    }
+}
+
+int EdgeSort::bitsFor(uint64_t value) {
+    int bits = 0;
+    while (value > 0) {
+        bits++;
+        value >>= 1;
+    }
+    return bits;
+}
+
+bool EdgeSort::computeIntegerKeys(const std::vector<WeightedEdge>& edges,
+                                  std::vector<uint32_t>& keys, uint32_t& maxKey) {
+    size_t n = edges.size();
+    keys.resize(n);
+    size_t chunks = Parallel::chunkCount(n);
+
+    for (KeyMode mode : {KeyMode::Integer, KeyMode::SquaredInteger}) {
+        std::vector<char> valid(chunks, 1);
+        std::vector<uint32_t> chunkMax(chunks, 0);
+
+        Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+            uint32_t localMax = 0;
+            for (size_t i = begin; i < end; ++i) {
+                if (!toKey(std::get<0>(edges[i]), mode, keys[i])) {
+                    valid[c] = 0;
+                    return;
+                }
+                localMax = std::max(localMax, keys[i]);
+            }
+            chunkMax[c] = localMax;
+        });
+
+        if (std::find(valid.begin(), valid.end(), 0) == valid.end()) {
+            maxKey = *std::max_element(chunkMax.begin(), chunkMax.end());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void EdgeSort::radixSortRecords(std::vector<uint64_t>& records, int shift, int keyBits,
+                                unsigned threads) {
+    size_t n = records.size();
+    if (n < 2 || keyBits <= 0) return;
+
+    size_t chunks = Parallel::chunkCount(n, threads);
+    std::vector<uint64_t> buffer(n);
+    std::vector<std::vector<size_t>> histogram(chunks, std::vector<size_t>(DIGIT_COUNT));
+
+    for (int pass = 0; pass * DIGIT_BITS < keyBits; ++pass) {
+        int digitShift = shift + pass * DIGIT_BITS;
+        const uint64_t mask = DIGIT_COUNT - 1;
+
+        // Histograma paralelo: um por bloco
+        Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+            std::vector<size_t>& h = histogram[c];
+            std::fill(h.begin(), h.end(), 0);
+            for (size_t i = begin; i < end; ++i) {
+                h[(records[i] >> digitShift) & mask]++;
+            }
+        });
+
+        // Prefixos em ordem (dígito, bloco) mantêm a estabilidade;
+        // se todos caem no mesmo dígito a passada é dispensável
+        size_t offset = 0;
+        bool trivialPass = false;
+        for (size_t d = 0; d < DIGIT_COUNT; ++d) {
+            size_t digitTotal = 0;
+            for (size_t c = 0; c < chunks; ++c) {
+                size_t count = histogram[c][d];
+                histogram[c][d] = offset;
+                offset += count;
+                digitTotal += count;
+            }
+            if (digitTotal == n) trivialPass = true;
+        }
+        if (trivialPass) continue;
+
+        // Distribuição paralela: cada bloco escreve nas suas posições reservadas
+        Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+            std::vector<size_t>& position = histogram[c];
+            for (size_t i = begin; i < end; ++i) {
+                buffer[position[(records[i] >> digitShift) & mask]++] = records[i];
+            }
+        });
+
+        records.swap(buffer);
+    }
+}
+
+void EdgeSort::sortEdges(std::vector<WeightedEdge>& edges, unsigned threads) {
+    size_t n = edges.size();
+    if (n < 2) return;
+
+    std::vector<uint32_t> keys;
+    uint32_t maxKey = 0;
+    int indexBits = bitsFor(n - 1);
+
+    int minVertex = 0, maxU = 0, maxV = 0;
+    for (const WeightedEdge& e : edges) {
+        minVertex = std::min(minVertex, std::min(std::get<1>(e), std::get<2>(e)));
+        maxU = std::max(maxU, std::get<1>(e));
+        maxV = std::max(maxV, std::get<2>(e));
+    }
+
+    if (minVertex < 0 || !computeIntegerKeys(edges, keys, maxKey) ||
+        std::max(bitsFor(maxKey), bitsFor(std::max(maxU, maxV))) + indexBits > 64) {
+        std::sort(edges.begin(), edges.end());
+        return;
+    }
+
+    // Registro = (campo << indexBits) | índice original. Passadas LSD estáveis
+    // por v, depois u, depois a chave do peso dão a ordem da tupla (peso, u, v)
+    const uint64_t indexMask = indexBits == 64 ? ~uint64_t(0) : ((uint64_t(1) << indexBits) - 1);
+    std::vector<uint64_t> records(n);
+    Parallel::forEach(n, [&](size_t i) {
+        records[i] = (static_cast<uint64_t>(std::get<2>(edges[i])) << indexBits) | i;
+    }, threads);
+    radixSortRecords(records, indexBits, bitsFor(maxV), threads);
+
+    Parallel::forEach(n, [&](size_t i) {
+        uint64_t index = records[i] & indexMask;
+        records[i] = (static_cast<uint64_t>(std::get<1>(edges[index])) << indexBits) | index;
+    }, threads);
+    radixSortRecords(records, indexBits, bitsFor(maxU), threads);
+
+    Parallel::forEach(n, [&](size_t i) {
+        uint64_t index = records[i] & indexMask;
+        records[i] = (static_cast<uint64_t>(keys[index]) << indexBits) | index;
+    }, threads);
+    keys.clear();
+    keys.shrink_to_fit();
+    radixSortRecords(records, indexBits, bitsFor(maxKey), threads);
+
+    std::vector<WeightedEdge> sorted(n);
+    Parallel::forEach(n, [&](size_t i) {
+        sorted[i] = edges[records[i] & indexMask];
+    }, threads);
+
+    edges.swap(sorted);
+}
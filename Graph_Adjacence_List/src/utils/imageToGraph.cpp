@@ -13,6 +13,14 @@ static double grayDistance(uint8_t a, uint8_t b) {
     return std::abs(a - b);
 }
 
+void ImageGraphConverter::addPixelVertices(int rows, int cols, UndirectedGraph& graph) {
+    // Todos os vértices antes das arestas: o vizinho (y + 1, x) não pode ser
+    // numerado antes de (y, x + 1)
+    for (int u = 0; u < rows * cols; ++u) {
+        graph.addVertex(std::to_string(u));
+    }
+}
+
 void ImageGraphConverter::imageToGraphRGB(
     const std::vector<std::vector<std::array<uint8_t, 3>>>& image,
     UndirectedGraph& graph,
@@ -29,11 +37,12 @@ void ImageGraphConverter::imageToGraphRGB(
         neighbors.push_back(std::make_pair(-1, 1));
     }
 
+    addPixelVertices(rows, cols, graph);
+
     for (int y = 0; y < rows; ++y) {
         for (int x = 0; x < cols; ++x) {
             int u = y * cols + x;
             std::string labelU = std::to_string(u);
-            graph.addVertex(labelU);
 
             for (size_t i = 0; i < neighbors.size(); ++i) {
                 int dy = neighbors[i].first;
@@ -46,7 +55,6 @@ void ImageGraphConverter::imageToGraphRGB(
                     std::string labelV = std::to_string(v);
 
                     double weight = rgbDistance(image[y][x], image[ny][nx]);
-                    graph.addVertex(labelV);
                     graph.addEdge(labelU, labelV, weight);
                 }
             }
@@ -70,11 +78,12 @@ void ImageGraphConverter::imageToGraphGray(
         neighbors.push_back(std::make_pair(-1, 1));
     }
 
+    addPixelVertices(rows, cols, graph);
+
     for (int y = 0; y < rows; ++y) {
         for (int x = 0; x < cols; ++x) {
             int u = y * cols + x;
             std::string labelU = std::to_string(u);
-            graph.addVertex(labelU);
 
             for (size_t i = 0; i < neighbors.size(); ++i) {
                 int dy = neighbors[i].first;
@@ -87,7 +96,6 @@ void ImageGraphConverter::imageToGraphGray(
                     std::string labelV = std::to_string(v);
 
                     double weight = grayDistance(image[y][x], image[ny][nx]);
-                    graph.addVertex(labelV);
                     graph.addEdge(labelU, labelV, weight);
                 }
             }
@@ -0,0 +1,272 @@
+#include "utils/knn_graph.h"
+#include "utils/parallel.h"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    const float INF = std::numeric_limits<float>::infinity();
+    const int LEAF = KnnGraphBuilder::LEAF;
+
+    struct KdNode {
+        int begin, end;             // intervalo em perm
+        int left = -1, right = -1;  // -1 em folhas
+        int dimension = 0;
+        float split = 0.0f;
+    };
+
+    // kd-tree com forma implícita: o corte de [begin, end) fica sempre no primeiro
+    // múltiplo de LEAF a partir da metade, então a forma depende só de N e os nós
+    // são criados antes da construção (que então pode ser paralela sem travas)
+    class KdTree {
+    public:
+        KdTree(const std::vector<float>& points, size_t dimensions, unsigned threads)
+            : points(points), dimensions(dimensions) {
+            int n = static_cast<int>(points.size() / dimensions);
+            perm.resize(n);
+            for (int i = 0; i < n; ++i) perm[i] = i;
+            createNodes(0, n);
+
+            int parallelDepth = 0;
+            while ((1u << parallelDepth) < Parallel::resolveThreads(threads)) parallelDepth++;
+            build(0, 0, parallelDepth);
+
+            // Folhas transpostas: [(bloco * dimensions + d) * LEAF + j]; o enchimento
+            // da última folha fica em +∞ (distância infinita, nunca entra)
+            size_t blocks = (static_cast<size_t>(n) + LEAF - 1) / LEAF;
+            leafData.assign(blocks * dimensions * LEAF, INF);
+            Parallel::forEach(n, [&](size_t i) {
+                size_t block = i / LEAF, lane = i % LEAF;
+                const float* p = &points[static_cast<size_t>(perm[i]) * dimensions];
+                for (size_t d = 0; d < dimensions; ++d) {
+                    leafData[(block * dimensions + d) * LEAF + lane] = p[d];
+                }
+            }, threads);
+        }
+
+        const std::vector<int>& order() const { return perm; }
+
+        // Insere em (bestDistance, bestIndex), ordenados, os k mais próximos de q
+        // exceto self; distâncias ao quadrado
+        void query(const float* q, int self, int k, float* bestDistance, int* bestIndex) const {
+            search(0, q, self, k, bestDistance, bestIndex);
+        }
+
+    private:
+        const std::vector<float>& points;
+        size_t dimensions;
+        std::vector<int> perm;
+        std::vector<KdNode> nodes;
+        std::vector<float> leafData;
+
+        int createNodes(int begin, int end) {
+            int id = static_cast<int>(nodes.size());
+            nodes.push_back(KdNode{begin, end});
+            int count = end - begin;
+            if (count > LEAF) {
+                int half = (count / 2 + LEAF - 1) / LEAF * LEAF;
+                int left = createNodes(begin, begin + half);
+                int right = createNodes(begin + half, end);
+                nodes[id].left = left;
+                nodes[id].right = right;
+            }
+            return id;
+        }
+
+        void build(int id, int depth, int parallelDepth) {
+            KdNode& node = nodes[id];
+            if (node.left < 0) return;
+
+            // Dimensão de maior extensão no intervalo
+            std::vector<float> low(dimensions, INF), high(dimensions, -INF);
+            for (int i = node.begin; i < node.end; ++i) {
+                const float* p = &points[static_cast<size_t>(perm[i]) * dimensions];
+                for (size_t d = 0; d < dimensions; ++d) {
+                    low[d] = std::min(low[d], p[d]);
+                    high[d] = std::max(high[d], p[d]);
+                }
+            }
+            size_t dimension = 0;
+            for (size_t d = 1; d < dimensions; ++d) {
+                if (high[d] - low[d] > high[dimension] - low[dimension]) dimension = d;
+            }
+
+            int mid = nodes[node.right].begin;
+            auto coordinate = [&](int i) { return points[static_cast<size_t>(i) * dimensions + dimension]; };
+            std::nth_element(perm.begin() + node.begin, perm.begin() + mid, perm.begin() + node.end,
+                             [&](int a, int b) {
+                                 float ca = coordinate(a), cb = coordinate(b);
+                                 return ca < cb || (ca == cb && a < b);
+                             });
+            node.dimension = static_cast<int>(dimension);
+            node.split = coordinate(perm[mid]);
+
+            int left = node.left, right = node.right;
+            if (depth < parallelDepth) {
+                Parallel::forChunks(2, 2, [&](size_t chunk, size_t, size_t) {
+                    build(chunk == 0 ? left : right, depth + 1, parallelDepth);
+                });
+            } else {
+                build(left, depth + 1, parallelDepth);
+                build(right, depth + 1, parallelDepth);
+            }
+        }
+
+        void search(int id, const float* q, int self, int k, float* bestDistance, int* bestIndex) const {
+            const KdNode& node = nodes[id];
+            if (node.left < 0) {
+                // LEAF distâncias de uma vez, uma faixa por ponto
+                const float* block = &leafData[static_cast<size_t>(node.begin / LEAF) * dimensions * LEAF];
+                float distances[LEAF] = {};
+                for (size_t d = 0; d < dimensions; ++d) {
+                    float value = q[d];
+                    for (int j = 0; j < LEAF; ++j) {
+                        float diff = value - block[d * LEAF + j];
+                        distances[j] += diff * diff;
+                    }
+                }
+                for (int j = 0; j < node.end - node.begin; ++j) {
+                    int index = perm[node.begin + j];
+                    float distance = distances[j];
+                    if (index == self) continue;
+                    if (distance > bestDistance[k - 1] ||
+                        (distance == bestDistance[k - 1] && index > bestIndex[k - 1])) continue;
+                    int slot = k - 1;
+                    while (slot > 0 && (distance < bestDistance[slot - 1] ||
+                                        (distance == bestDistance[slot - 1] && index < bestIndex[slot - 1]))) {
+                        bestDistance[slot] = bestDistance[slot - 1];
+                        bestIndex[slot] = bestIndex[slot - 1];
+                        slot--;
+                    }
+                    bestDistance[slot] = distance;
+                    bestIndex[slot] = index;
+                }
+                return;
+            }
+
+            float diff = q[node.dimension] - node.split;
+            int nearSide = diff < 0.0f ? node.left : node.right;
+            int farSide = diff < 0.0f ? node.right : node.left;
+            search(nearSide, q, self, k, bestDistance, bestIndex);
+            if (diff * diff <= bestDistance[k - 1]) {
+                search(farSide, q, self, k, bestDistance, bestIndex);
+            }
+        }
+    };
+}
+
+KnnGraphBuilder::KnnGraphBuilder(int k, unsigned threads) : k(k), threads(threads) {
+    if (k < 1) {
+        throw std::invalid_argument("k-NN graph needs k >= 1: " + std::to_string(k));
+    }
+}
+
+KnnGraphBuilder::Neighbors KnnGraphBuilder::findNeighbors(const std::vector<float>& points,
+                                                          size_t dimensions) const {
+    if (dimensions == 0 || points.size() % dimensions != 0) {
+        throw std::invalid_argument("Point matrix size " + std::to_string(points.size()) +
+                                    " is not a multiple of " + std::to_string(dimensions));
+    }
+    if (points.size() / dimensions > static_cast<size_t>(INT_MAX)) {
+        throw std::invalid_argument("Too many points for int vertex ids");
+    }
+
+    int n = static_cast<int>(points.size() / dimensions);
+    Neighbors result;
+    result.k = k;
+    result.index.assign(static_cast<size_t>(n) * k, -1);
+    result.distance.assign(static_cast<size_t>(n) * k, INF);
+    if (n == 0) return result;
+
+    KdTree tree(points, dimensions, threads);
+    const std::vector<int>& order = tree.order();
+
+    // Consultas na ordem das folhas: pontos consecutivos visitam as mesmas folhas
+    Parallel::forEach(n, [&](size_t position) {
+        int i = order[position];
+        float* distance = &result.distance[static_cast<size_t>(i) * k];
+        int* index = &result.index[static_cast<size_t>(i) * k];
+        tree.query(&points[static_cast<size_t>(i) * dimensions], i, k, distance, index);
+        for (int j = 0; j < k && index[j] >= 0; ++j) distance[j] = std::sqrt(distance[j]);
+    }, threads, 1 << 10);
+
+    return result;
+}
+
+std::vector<std::tuple<double, int, int>> KnnGraphBuilder::symmetrize(const Neighbors& neighbors,
+                                                                      int pointCount, unsigned threads) {
+    int k = neighbors.k;
+
+    // Listas reversas (quem tem v como vizinho), já em ordem crescente de origem
+    std::vector<int> reverseOffsets(pointCount + 1, 0);
+    for (int v : neighbors.index) {
+        if (v >= 0) reverseOffsets[v + 1]++;
+    }
+    for (int v = 0; v < pointCount; ++v) reverseOffsets[v + 1] += reverseOffsets[v];
+    std::vector<int> reverseSource(reverseOffsets[pointCount]);
+    std::vector<float> reverseDistance(reverseOffsets[pointCount]);
+    std::vector<int> next(reverseOffsets.begin(), reverseOffsets.end() - 1);
+    for (int u = 0; u < pointCount; ++u) {
+        for (int j = 0; j < k; ++j) {
+            int v = neighbors.index[static_cast<size_t>(u) * k + j];
+            if (v < 0) continue;
+            reverseSource[next[v]] = u;
+            reverseDistance[next[v]] = neighbors.distance[static_cast<size_t>(u) * k + j];
+            next[v]++;
+        }
+    }
+
+    // Para cada u, parceiros v > u: união dos vizinhos de u com quem aponta
+    // para u. Blocos em paralelo, concatenados em ordem (determinístico)
+    size_t chunks = Parallel::chunkCount(pointCount, threads, 1 << 12);
+    std::vector<std::vector<std::tuple<double, int, int>>> partial(chunks);
+    Parallel::forChunks(pointCount, chunks, [&](size_t chunk, size_t begin, size_t end) {
+        std::vector<std::pair<int, float>> partners;
+        for (size_t u = begin; u < end; ++u) {
+            partners.clear();
+            for (int j = 0; j < k; ++j) {
+                int v = neighbors.index[u * k + j];
+                if (v > static_cast<int>(u)) partners.emplace_back(v, neighbors.distance[u * k + j]);
+            }
+            for (int a = reverseOffsets[u]; a < reverseOffsets[u + 1]; ++a) {
+                if (reverseSource[a] > static_cast<int>(u)) {
+                    partners.emplace_back(reverseSource[a], reverseDistance[a]);
+                }
+            }
+            std::sort(partners.begin(), partners.end());
+            for (size_t p = 0; p < partners.size(); ++p) {
+                if (p > 0 && partners[p].first == partners[p - 1].first) continue;
+                partial[chunk].emplace_back(partners[p].second, static_cast<int>(u), partners[p].first);
+            }
+        }
+    });
+
+    size_t total = 0;
+    for (const auto& edges : partial) total += edges.size();
+    std::vector<std::tuple<double, int, int>> edges;
+    edges.reserve(total);
+    for (auto& part : partial) {
+        edges.insert(edges.end(), part.begin(), part.end());
+        std::vector<std::tuple<double, int, int>>().swap(part);
+    }
+    return edges;
+}
+
+std::vector<std::tuple<double, int, int>> KnnGraphBuilder::buildEdgeList(const std::vector<float>& points,
+                                                                         size_t dimensions) const {
+    Neighbors neighbors = findNeighbors(points, dimensions);
+    return symmetrize(neighbors, static_cast<int>(points.size() / dimensions), threads);
+}
+
+CSRGraph KnnGraphBuilder::buildCSR(const std::vector<float>& points, size_t dimensions) const {
+    return CSRGraph::fromEdgeList(static_cast<int>(points.size() / dimensions),
+                                  buildEdgeList(points, dimensions));
+}
+
+void KnnGraphBuilder::buildUndirectedGraph(const std::vector<float>& points, size_t dimensions,
+                                           UndirectedGraph& graph) const {
+    buildCSR(points, dimensions).toUndirectedGraph(graph);
+}
@@ -0,0 +1,230 @@
+#include "utils/region_adjacency_graph.h"
+#include "utils/indexed_heap.h"
+#include "utils/parallel.h"
+#include "utils/union_find.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+    // Contribuição de um par de pixels de fronteira, chave = (menor << 32 | maior)
+    struct BoundarySample {
+        uint64_t key;
+        double difference;
+    };
+
+    uint64_t pairKey(int a, int b) {
+        if (a > b) std::swap(a, b);
+        return (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b);
+    }
+
+    // Ordena por chave (estável) e acumula as amostras de cada par em uma aresta
+    void reduceSamples(std::vector<BoundarySample>& samples, std::vector<RegionEdge>& out) {
+        std::stable_sort(samples.begin(), samples.end(),
+            [](const BoundarySample& x, const BoundarySample& y) { return x.key < y.key; });
+
+        for (size_t i = 0; i < samples.size();) {
+            RegionEdge edge;
+            edge.a = static_cast<int>(samples[i].key >> 32);
+            edge.b = static_cast<int>(samples[i].key & 0xFFFFFFFFu);
+            uint64_t key = samples[i].key;
+            for (; i < samples.size() && samples[i].key == key; ++i) {
+                edge.boundaryLength++;
+                edge.contrastSum += samples[i].difference;
+            }
+            out.push_back(edge);
+        }
+    }
+}
+
+template <typename PixelColor, typename PixelDifference>
+RegionAdjacencyGraph RegionAdjacencyGraph::build(int width, int height, const std::vector<int>& labels,
+                                                 PixelColor colorAt, PixelDifference difference,
+                                                 unsigned threads) {
+    if (static_cast<long long>(width) * height != static_cast<long long>(labels.size())) {
+        throw std::invalid_argument("Label count does not match image dimensions.");
+    }
+
+    int regionCount = 0;
+    for (int label : labels) regionCount = std::max(regionCount, label + 1);
+
+    // Acumuladores parciais por bloco de linhas
+    struct Partial {
+        std::vector<int> area;
+        std::vector<std::array<uint64_t, 3>> colorSum;
+        std::vector<RegionEdge> edges;
+    };
+
+    size_t chunks = Parallel::chunkCount(height, threads, 64);
+    std::vector<Partial> partials(chunks);
+
+    Parallel::forChunks(height, chunks, [&](size_t c, size_t begin, size_t end) {
+        Partial& p = partials[c];
+        p.area.assign(regionCount, 0);
+        p.colorSum.assign(regionCount, {0, 0, 0});
+        std::vector<BoundarySample> samples;
+
+        for (int y = int(begin); y < int(end); ++y) {
+            const int* row = labels.data() + static_cast<size_t>(y) * width;
+            for (int x = 0; x < width; ++x) {
+                int r = row[x];
+                p.area[r]++;
+                std::array<uint8_t, 3> color = colorAt(x, y);
+                for (int ch = 0; ch < 3; ++ch) p.colorSum[r][ch] += color[ch];
+
+                // Só pares com rótulos distintos (pixels de fronteira) geram amostras
+                if (x + 1 < width && row[x + 1] != r) {
+                    samples.push_back({pairKey(r, row[x + 1]), difference(x, y, x + 1, y)});
+                }
+                if (y + 1 < height && row[x + width] != r) {
+                    samples.push_back({pairKey(r, row[x + width]), difference(x, y, x, y + 1)});
+                }
+            }
+        }
+
+        reduceSamples(samples, p.edges);
+    });
+
+    RegionAdjacencyGraph rag;
+    rag.area.assign(regionCount, 0);
+    rag.colorSum.assign(regionCount, {0, 0, 0});
+    Parallel::forEach(regionCount, [&](size_t r) {
+        for (const Partial& p : partials) {
+            rag.area[r] += p.area[r];
+            for (int ch = 0; ch < 3; ++ch) rag.colorSum[r][ch] += p.colorSum[r][ch];
+        }
+    }, threads, 1024);
+
+    // Combinação das arestas na ordem dos blocos (determinística para um dado número de blocos)
+    std::vector<RegionEdge> merged;
+    for (const Partial& p : partials) merged.insert(merged.end(), p.edges.begin(), p.edges.end());
+    std::stable_sort(merged.begin(), merged.end(), [](const RegionEdge& x, const RegionEdge& y) {
+        return x.a < y.a || (x.a == y.a && x.b < y.b);
+    });
+    for (const RegionEdge& edge : merged) {
+        if (!rag.edges.empty() && rag.edges.back().a == edge.a && rag.edges.back().b == edge.b) {
+            rag.edges.back().boundaryLength += edge.boundaryLength;
+            rag.edges.back().contrastSum += edge.contrastSum;
+        } else {
+            rag.edges.push_back(edge);
+        }
+    }
+
+    std::vector<std::tuple<double, int, int>> weighted;
+    weighted.reserve(rag.edges.size());
+    for (const RegionEdge& edge : rag.edges) weighted.emplace_back(edge.contrast(), edge.a, edge.b);
+    rag.csr = CSRGraph::fromEdgeList(regionCount, weighted);
+
+    return rag;
+}
+
+RegionAdjacencyGraph RegionAdjacencyGraph::fromLabels(
+    const std::vector<std::vector<std::array<uint8_t, 3>>>& image,
+    const std::vector<int>& labels, unsigned threads) {
+    int height = image.size();
+    int width = height > 0 ? image[0].size() : 0;
+    return build(width, height, labels,
+        [&](int x, int y) { return image[y][x]; },
+        [&](int x1, int y1, int x2, int y2) {
+            const std::array<uint8_t, 3>& a = image[y1][x1];
+            const std::array<uint8_t, 3>& b = image[y2][x2];
+            int sum = 0;
+            for (int ch = 0; ch < 3; ++ch) sum += (a[ch] - b[ch]) * (a[ch] - b[ch]);
+            return std::sqrt(static_cast<double>(sum));
+        }, threads);
+}
+
+RegionAdjacencyGraph RegionAdjacencyGraph::fromLabels(
+    const std::vector<std::vector<uint8_t>>& image,
+    const std::vector<int>& labels, unsigned threads) {
+    int height = image.size();
+    int width = height > 0 ? image[0].size() : 0;
+    return build(width, height, labels,
+        [&](int x, int y) {
+            uint8_t value = image[y][x];
+            return std::array<uint8_t, 3>{value, value, value};
+        },
+        [&](int x1, int y1, int x2, int y2) {
+            return static_cast<double>(std::abs(image[y1][x1] - image[y2][x2]));
+        }, threads);
+}
+
+std::array<double, 3> RegionAdjacencyGraph::getMeanColor(int region) const {
+    std::array<double, 3> mean = {0.0, 0.0, 0.0};
+    if (area[region] == 0) return mean;
+    for (int ch = 0; ch < 3; ++ch) mean[ch] = static_cast<double>(colorSum[region][ch]) / area[region];
+    return mean;
+}
+
+std::vector<int> RegionAdjacencyGraph::mergeRegions(int targetRegionCount, double maxContrast) const {
+    int regionCount = getRegionCount();
+    std::vector<RegionEdge> work = edges;
+    std::vector<std::unordered_map<int, int>> adjacency(regionCount);   // vizinho -> aresta
+    IndexedMinHeap<double> queue(static_cast<int>(work.size()));
+
+    for (int e = 0; e < int(work.size()); e++) {
+        adjacency[work[e].a][work[e].b] = e;
+        adjacency[work[e].b][work[e].a] = e;
+        queue.push(e, work[e].contrast());
+    }
+
+    UnionFind ds(regionCount);
+    int remaining = regionCount;
+
+    while (remaining > targetRegionCount && !queue.empty() && queue.topKey() <= maxContrast) {
+        const RegionEdge& chosen = work[queue.pop()];
+
+        // A região com mais vizinhos absorve a outra (menos atualizações de mapa)
+        int keep = chosen.a;
+        int drop = chosen.b;
+        if (adjacency[keep].size() < adjacency[drop].size()) std::swap(keep, drop);
+        adjacency[keep].erase(drop);
+
+        for (const auto& entry : adjacency[drop]) {
+            int neighbor = entry.first;
+            int e = entry.second;
+            if (neighbor == keep) continue;
+            adjacency[neighbor].erase(drop);
+
+            auto existing = adjacency[keep].find(neighbor);
+            if (existing != adjacency[keep].end()) {
+                // Fronteiras paralelas viram uma só: soma comprimentos e contrastes
+                RegionEdge& target = work[existing->second];
+                target.boundaryLength += work[e].boundaryLength;
+                target.contrastSum += work[e].contrastSum;
+                queue.remove(e);
+                queue.update(existing->second, target.contrast());
+            } else {
+                RegionEdge& moved = work[e];
+                if (moved.a == drop) moved.a = keep;
+                else moved.b = keep;
+                adjacency[keep][neighbor] = e;
+                adjacency[neighbor][keep] = e;
+            }
+        }
+        adjacency[drop].clear();
+
+        ds.forceJoin(ds.find(keep), ds.find(drop));
+        remaining--;
+    }
+
+    // Rótulos densos na ordem da menor região original de cada grupo
+    std::vector<int> regionMap(regionCount);
+    std::vector<int> rootLabel(regionCount, -1);
+    int next = 0;
+    for (int r = 0; r < regionCount; r++) {
+        int root = ds.find(r);
+        if (rootLabel[root] == -1) rootLabel[root] = next++;
+        regionMap[r] = rootLabel[root];
+    }
+    return regionMap;
+}
+
+std::vector<int> RegionAdjacencyGraph::relabel(const std::vector<int>& labels,
+                                               const std::vector<int>& regionMap) {
+    std::vector<int> result(labels.size());
+    Parallel::forEach(labels.size(), [&](size_t i) { result[i] = regionMap[labels[i]]; });
+    return result;
+}
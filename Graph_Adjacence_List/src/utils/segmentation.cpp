@@ -1,23 +1,21 @@
 #include "Utils/segmentation.h"
+#include "utils/edge_sort.h"
+#include "utils/parallel.h"
 #include <iostream>
 #include <algorithm>
+#include <stdexcept>
+#include <atomic>
 
-vector<int> Segmentation::segmentGraph(UndirectedGraph& graph, double k, int min_size) {
+vector<int> Segmentation::segmentGraph(UndirectedGraph& graph, double k, int min_size,
+                                       bool verbose) {
     int n = graph.getVertices().size();
     UnionFind ds(n);
 
     // Construir todas as arestas do grafo
-    std::vector<std::tuple<double, int, int>> edges;
-    for (int u = 0; u < n; u++) {
-        std::vector<Edge> neighbors = graph.getNeighborsInternal(u);
-        for (Edge e : neighbors) {
-            if (u < e.to) {
-                edges.push_back({e.weight, u, e.to});
-            }
-        }
-    }
+    std::vector<WeightedEdge> edges = collectEdges(graph);
 
-    std::sort(edges.begin(), edges.end());
+    // Ordenação linear (radix) quando os pesos admitem chave inteira exata
+    EdgeSort::sortEdges(edges);
 
     // Segmentação principal
     for (const auto& edge : edges) {
@@ -28,41 +26,348 @@ vector<int> Segmentation::segmentGraph(UndirectedGraph& graph, double k, int min
     }
 
     // Segunda passagem: aplicar min_size
-    for (const auto& edge : edges) {
-        int u = std::get<1>(edge);
-        int v = std::get<2>(edge);
-        int comp_u = ds.find(u);
-        int comp_v = ds.find(v);
+    mergeSmallComponents(ds, edges, min_size, 0);
+
+    return finalizeComponents(graph, ds, verbose, 0);
+}
+
+vector<int> Segmentation::segmentGraphTiled(UndirectedGraph& graph, int width, int height,
+                                            double k, int min_size, int tileSize,
+                                            unsigned threads, bool verbose) {
+    int n = graph.getVertices().size();
+    if (width <= 0 || height <= 0 || static_cast<long long>(width) * height != n) {
+        throw invalid_argument("Graph size does not match image dimensions.");
+    }
+    if (tileSize <= 0) {
+        throw invalid_argument("Tile size must be positive.");
+    }
+
+    UnionFind ds(n);
+    std::vector<WeightedEdge> edges = collectEdges(graph);
+    EdgeSort::sortEdges(edges, threads);
+
+    // Bloco de cada vértice; arestas entre blocos diferentes vão para a costura
+    int tilesX = (width + tileSize - 1) / tileSize;
+    int tilesY = (height + tileSize - 1) / tileSize;
+    int tileCount = tilesX * tilesY;
+    auto tileOf = [&](int vertex) {
+        return (vertex / width / tileSize) * tilesX + (vertex % width) / tileSize;
+    };
+    auto bucketOf = [&](const WeightedEdge& edge) {
+        int tu = tileOf(std::get<1>(edge));
+        return tu == tileOf(std::get<2>(edge)) ? tu : tileCount;
+    };
+
+    // Distribuição estável das arestas ordenadas por bloco (contagem paralela)
+    size_t m = edges.size();
+    size_t chunks = Parallel::chunkCount(m, threads);
+    std::vector<std::vector<size_t>> counts(chunks, std::vector<size_t>(tileCount + 1, 0));
+
+    Parallel::forChunks(m, chunks, [&](size_t c, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) counts[c][bucketOf(edges[i])]++;
+    });
+
+    std::vector<size_t> bucketStart(tileCount + 2, 0);
+    size_t offset = 0;
+    for (int b = 0; b <= tileCount; ++b) {
+        bucketStart[b] = offset;
+        for (size_t c = 0; c < chunks; ++c) {
+            size_t count = counts[c][b];
+            counts[c][b] = offset;
+            offset += count;
+        }
+    }
+    bucketStart[tileCount + 1] = offset;
 
-        if (comp_u != comp_v) {
-            int size_u = ds.getSize(comp_u);
-            int size_v = ds.getSize(comp_v);
+    std::vector<WeightedEdge> byTile(m);
+    Parallel::forChunks(m, chunks, [&](size_t c, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) byTile[counts[c][bucketOf(edges[i])]++] = edges[i];
+    });
 
-            if (size_u < min_size || size_v < min_size) {
-                ds.forceJoin(comp_u, comp_v);  // novo método que une componentes incondicionalmente
+    // Segmentação principal por bloco: os blocos têm vértices disjuntos,
+    // então as threads nunca tocam as mesmas entradas do UnionFind
+    Parallel::forEach(tileCount, [&](size_t tile) {
+        for (size_t i = bucketStart[tile]; i < bucketStart[tile + 1]; ++i) {
+            const WeightedEdge& edge = byTile[i];
+            ds.join(std::get<1>(edge), std::get<2>(edge), std::get<0>(edge), k);
+        }
+    }, threads, 1);
+
+    // Costura: arestas entre blocos em ordem de peso, sobre o estado já unido
+    for (size_t i = bucketStart[tileCount]; i < bucketStart[tileCount + 1]; ++i) {
+        const WeightedEdge& edge = byTile[i];
+        ds.join(std::get<1>(edge), std::get<2>(edge), std::get<0>(edge), k);
+    }
+
+    mergeSmallComponentsTiled(ds, byTile, bucketStart, width, tileSize, min_size, threads);
+
+    return finalizeComponents(graph, ds, verbose, threads);
+}
+
+std::vector<Segmentation::WeightedEdge> Segmentation::collectEdges(UndirectedGraph& graph) {
+    return graph.getEdgeList();
+}
+
+void Segmentation::mergeSmallComponents(UnionFind& ds, const std::vector<WeightedEdge>& edges,
+                                        int min_size, unsigned threads) {
+    if (min_size <= 1) return;
+
+    // Filtro paralelo sobre um retrato somente-leitura do UnionFind: tamanhos só
+    // crescem e componentes só se unem, então uma aresta descartada aqui também
+    // seria ignorada pela passagem sequencial original
+    size_t m = edges.size();
+    size_t chunks = Parallel::chunkCount(m, threads);
+    std::vector<std::vector<size_t>> candidates(chunks);
+
+    Parallel::forChunks(m, chunks, [&](size_t c, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            int comp_u = ds.findRoot(std::get<1>(edges[i]));
+            int comp_v = ds.findRoot(std::get<2>(edges[i]));
+            if (comp_u != comp_v &&
+                (ds.getRootSize(comp_u) < min_size || ds.getRootSize(comp_v) < min_size)) {
+                candidates[c].push_back(i);
+            }
+        }
+    });
+
+    // Passagem sequencial apenas sobre as candidatas, na ordem original
+    for (const auto& chunk : candidates) {
+        for (size_t i : chunk) {
+            int comp_u = ds.find(std::get<1>(edges[i]));
+            int comp_v = ds.find(std::get<2>(edges[i]));
+
+            if (comp_u != comp_v) {
+                int size_u = ds.getSize(comp_u);
+                int size_v = ds.getSize(comp_v);
+
+                if (size_u < min_size || size_v < min_size) {
+                    ds.forceJoin(comp_u, comp_v);  // une componentes incondicionalmente
+                }
             }
         }
     }
+}
+
+void Segmentation::mergeSmallComponentsTiled(UnionFind& ds, const std::vector<WeightedEdge>& byTile,
+                                             const std::vector<size_t>& bucketStart, int width,
+                                             int tileSize, int min_size, unsigned threads) {
+    if (min_size <= 1) return;
+
+    int n = ds.elementCount();
+    int tileCount = static_cast<int>(bucketStart.size()) - 2;
+    int tilesX = (width + tileSize - 1) / tileSize;
+    auto tileOf = [&](int vertex) {
+        return (vertex / width / tileSize) * tilesX + (vertex % width) / tileSize;
+    };
+
+    // Componentes que atravessam blocos (unidos pela costura): a raiz está em
+    // outro bloco que algum de seus vértices
+    std::vector<std::atomic<uint8_t>> spanning(n);
+    Parallel::forEach(n, [&](size_t v) {
+        int root = ds.findRoot(int(v));
+        if (tileOf(root) != tileOf(int(v))) spanning[root].store(1, std::memory_order_relaxed);
+    }, threads);
 
-    // Agrupar rótulos finais
-    std::unordered_map<int, std::vector<std::string>> components;
+    // Por bloco, em paralelo: arestas internas entre componentes contidos no
+    // bloco. Esses componentes têm todos os vértices no bloco e uniões entre eles
+    // continuam contidas, então cada thread só escreve no UnionFind dentro do seu
+    // bloco. Componentes que atravessam blocos não são alterados nesta fase (e
+    // são lidos sem compressão de caminho); arestas que os tocam ficam para a
+    // passagem ordenada
+    std::vector<std::vector<size_t>> deferred(tileCount);
+    Parallel::forEach(tileCount, [&](size_t tile) {
+        for (size_t i = bucketStart[tile]; i < bucketStart[tile + 1]; ++i) {
+            const WeightedEdge& edge = byTile[i];
+            int u = std::get<1>(edge), v = std::get<2>(edge);
+            if (spanning[ds.findRoot(u)].load(std::memory_order_relaxed) ||
+                spanning[ds.findRoot(v)].load(std::memory_order_relaxed)) {
+                deferred[tile].push_back(i);
+                continue;
+            }
+            int comp_u = ds.find(u);
+            int comp_v = ds.find(v);
+            if (comp_u != comp_v && (ds.getSize(comp_u) < min_size || ds.getSize(comp_v) < min_size)) {
+                ds.forceJoin(comp_u, comp_v);
+            }
+        }
+    }, threads, 1);
+
+    // Passagem ordenada: arestas adiadas e de costura, em ordem de peso (empates
+    // na ordem dos blocos), com o mesmo filtro de retrato da versão sequencial
+    std::vector<size_t> remaining;
+    for (const auto& tileEdges : deferred) remaining.insert(remaining.end(), tileEdges.begin(), tileEdges.end());
+    for (size_t i = bucketStart[tileCount]; i < bucketStart[tileCount + 1]; ++i) remaining.push_back(i);
+    std::stable_sort(remaining.begin(), remaining.end(), [&](size_t a, size_t b) {
+        return std::get<0>(byTile[a]) < std::get<0>(byTile[b]);
+    });
+
+    std::vector<WeightedEdge> ordered(remaining.size());
+    Parallel::forEach(remaining.size(), [&](size_t i) { ordered[i] = byTile[remaining[i]]; }, threads);
+    mergeSmallComponents(ds, ordered, min_size, threads);
+}
+
+vector<int> Segmentation::finalizeComponents(UndirectedGraph& graph, UnionFind& ds,
+                                             bool verbose, unsigned threads) {
+    int n = ds.elementCount();
+
+    // Raiz de cada vértice (leitura concorrente, sem compressão de caminho)
     std::vector<int> componentIds(n);
-    for (int i = 0; i < n; i++) {
-        int root = ds.find(i);
-        componentIds[i] = root;
-        components[root].push_back(graph.getVertices()[i].label);
+    Parallel::forEach(n, [&](size_t i) { componentIds[i] = ds.findRoot(int(i)); }, threads);
+
+    // Rótulo denso de cada raiz = número de raízes com índice menor (prefixo por blocos)
+    size_t chunks = Parallel::chunkCount(n, threads);
+    std::vector<int> rootsBefore(chunks + 1, 0);
+    Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+        int count = 0;
+        for (size_t i = begin; i < end; ++i) count += (componentIds[i] == int(i));
+        rootsBefore[c + 1] = count;
+    });
+    for (size_t c = 0; c < chunks; ++c) rootsBefore[c + 1] += rootsBefore[c];
+    int componentCount = rootsBefore[chunks];
+
+    std::vector<int> denseId(n);
+    Parallel::forChunks(n, chunks, [&](size_t c, size_t begin, size_t end) {
+        int next = rootsBefore[c];
+        for (size_t i = begin; i < end; ++i) {
+            if (componentIds[i] == int(i)) denseId[i] = next++;
+        }
+    });
+    Parallel::forEach(n, [&](size_t i) { componentIds[i] = denseId[componentIds[i]]; }, threads);
+
+    if (verbose) {
+        const vector<Vertex>& vertices = graph.getVertices();
+        std::vector<std::vector<int>> components(componentCount);
+        for (int i = 0; i < n; i++) components[componentIds[i]].push_back(i);
+
+        std::cout << "Segmentação final:\n";
+        for (const auto& comp : components) {
+            std::cout << "Componente:";
+            for (int vertex : comp)
+                std::cout << " " << vertices[vertex].label;
+            std::cout << std::endl;
+        }
+
+        std::cout << "Quantidade de componentes: " << componentCount << std::endl;
+    }
+
+    return componentIds;
+}
+
+template <typename PixelAccess>
+std::vector<RegionStats> Segmentation::regionStats(int width, int height, const std::vector<int>& labels,
+                                                   PixelAccess pixelAt, unsigned threads) {
+    if (static_cast<long long>(width) * height != static_cast<long long>(labels.size())) {
+        throw invalid_argument("Label count does not match image dimensions.");
     }
 
-    std::cout << "Segmentação final:\n";
-    for (auto& [root, comp] : components) {
-        std::cout << "Componente:";
-        for (const auto& label : comp)
-            std::cout << " " << label;
-        std::cout << std::endl;
+    // Rótulos densos: cada região tem ao menos um pixel, logo rótulo < número de pixels
+    int regionCount = 0;
+    for (int label : labels) {
+        if (label < 0 || static_cast<size_t>(label) >= labels.size()) {
+            throw invalid_argument("Region labels must be in [0, pixel count).");
+        }
+        regionCount = std::max(regionCount, label + 1);
     }
 
-    std::cout << "Quantidade de componentes: " << components.size() << std::endl;
+    // Acumuladores parciais por bloco de linhas
+    struct Partial {
+        std::vector<int> area, minX, minY, maxX, maxY;
+        std::vector<std::array<uint64_t, 3>> colorSum;
+        std::vector<uint64_t> adjacency;   // pares (menor << 32 | maior)
+    };
 
-    return componentIds;
+    size_t chunks = Parallel::chunkCount(height, threads, 64);
+    std::vector<Partial> partials(chunks);
+
+    Parallel::forChunks(height, chunks, [&](size_t c, size_t begin, size_t end) {
+        Partial& p = partials[c];
+        p.area.assign(regionCount, 0);
+        p.minX.assign(regionCount, width);
+        p.minY.assign(regionCount, height);
+        p.maxX.assign(regionCount, -1);
+        p.maxY.assign(regionCount, -1);
+        p.colorSum.assign(regionCount, {0, 0, 0});
+
+        auto addPair = [&](int a, int b) {
+            if (a > b) std::swap(a, b);
+            p.adjacency.push_back((static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b));
+        };
+
+        for (int y = int(begin); y < int(end); ++y) {
+            const int* row = labels.data() + static_cast<size_t>(y) * width;
+            for (int x = 0; x < width; ++x) {
+                int r = row[x];
+                p.area[r]++;
+                p.minX[r] = std::min(p.minX[r], x);
+                p.maxX[r] = std::max(p.maxX[r], x);
+                p.minY[r] = std::min(p.minY[r], y);
+                p.maxY[r] = std::max(p.maxY[r], y);
+
+                std::array<uint8_t, 3> color = pixelAt(x, y);
+                for (int ch = 0; ch < 3; ++ch) p.colorSum[r][ch] += color[ch];
+
+                if (x + 1 < width && row[x + 1] != r) addPair(r, row[x + 1]);
+                if (y + 1 < height && row[x + width] != r) addPair(r, row[x + width]);
+            }
+        }
+
+        std::sort(p.adjacency.begin(), p.adjacency.end());
+        p.adjacency.erase(std::unique(p.adjacency.begin(), p.adjacency.end()), p.adjacency.end());
+    });
+
+    // Combinação dos parciais na ordem dos blocos
+    std::vector<RegionStats> stats(regionCount);
+    std::vector<uint64_t> adjacency;
+    Parallel::forEach(regionCount, [&](size_t r) {
+        RegionStats& s = stats[r];
+        s.minX = width;
+        s.minY = height;
+        std::array<uint64_t, 3> colorSum = {0, 0, 0};
+        for (const Partial& p : partials) {
+            s.area += p.area[r];
+            s.minX = std::min(s.minX, p.minX[r]);
+            s.minY = std::min(s.minY, p.minY[r]);
+            s.maxX = std::max(s.maxX, p.maxX[r]);
+            s.maxY = std::max(s.maxY, p.maxY[r]);
+            for (int ch = 0; ch < 3; ++ch) colorSum[ch] += p.colorSum[r][ch];
+        }
+        for (int ch = 0; ch < 3; ++ch) {
+            s.meanColor[ch] = s.area > 0 ? static_cast<double>(colorSum[ch]) / s.area : 0.0;
+        }
+    }, threads, 1024);
+
+    for (const Partial& p : partials) adjacency.insert(adjacency.end(), p.adjacency.begin(), p.adjacency.end());
+    std::sort(adjacency.begin(), adjacency.end());
+    adjacency.erase(std::unique(adjacency.begin(), adjacency.end()), adjacency.end());
+
+    for (uint64_t pair : adjacency) {
+        int a = static_cast<int>(pair >> 32);
+        int b = static_cast<int>(pair & 0xFFFFFFFFu);
+        stats[a].neighbors.push_back(b);
+        stats[b].neighbors.push_back(a);
+    }
+    for (RegionStats& s : stats) std::sort(s.neighbors.begin(), s.neighbors.end());
+
+    return stats;
 }
 
+std::vector<RegionStats> Segmentation::computeRegionStats(
+    const std::vector<std::vector<std::array<uint8_t, 3>>>& image,
+    const std::vector<int>& labels, unsigned threads) {
+    int height = image.size();
+    int width = height > 0 ? image[0].size() : 0;
+    return regionStats(width, height, labels,
+        [&](int x, int y) { return image[y][x]; }, threads);
+}
+
+std::vector<RegionStats> Segmentation::computeRegionStats(
+    const std::vector<std::vector<uint8_t>>& image,
+    const std::vector<int>& labels, unsigned threads) {
+    int height = image.size();
+    int width = height > 0 ? image[0].size() : 0;
+    return regionStats(width, height, labels,
+        [&](int x, int y) {
+            uint8_t value = image[y][x];
+            return std::array<uint8_t, 3>{value, value, value};
+        }, threads);
+}
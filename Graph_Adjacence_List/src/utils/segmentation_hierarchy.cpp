@@ -0,0 +1,137 @@
+#include "utils/segmentation_hierarchy.h"
+#include "utils/edge_sort.h"
+#include "utils/union_find.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace {
+    const char HIERARCHY_MAGIC[4] = {'S', 'H', 'T', '1'};
+}
+
+SegmentationHierarchy SegmentationHierarchy::build(UndirectedGraph& graph) {
+    std::vector<std::tuple<double, int, int>> edges = graph.getEdgeList();
+    EdgeSort::sortEdges(edges);
+    return fromSortedEdges(static_cast<int>(graph.getVertices().size()), edges);
+}
+
+SegmentationHierarchy SegmentationHierarchy::fromSortedEdges(
+    int vertexCount, const std::vector<std::tuple<double, int, int>>& edges) {
+
+    SegmentationHierarchy hierarchy;
+    hierarchy.leafCount = vertexCount;
+    hierarchy.parent.assign(vertexCount, -1);
+    hierarchy.altitude.assign(vertexCount, 0.0);
+    hierarchy.parent.reserve(2 * static_cast<size_t>(vertexCount));
+    hierarchy.altitude.reserve(2 * static_cast<size_t>(vertexCount));
+
+    // treeNode[raiz] = nó da hierarquia que representa o conjunto atual
+    UnionFind ds(vertexCount);
+    std::vector<int> treeNode(vertexCount);
+    for (int i = 0; i < vertexCount; i++) treeNode[i] = i;
+
+    for (const auto& edge : edges) {
+        int ru = ds.find(std::get<1>(edge));
+        int rv = ds.find(std::get<2>(edge));
+        if (ru == rv) continue;
+
+        int node = static_cast<int>(hierarchy.parent.size());
+        hierarchy.parent.push_back(-1);
+        hierarchy.altitude.push_back(std::get<0>(edge));
+        hierarchy.parent[treeNode[ru]] = node;
+        hierarchy.parent[treeNode[rv]] = node;
+
+        ds.forceJoin(ru, rv);
+        treeNode[ds.find(ru)] = node;
+    }
+
+    return hierarchy;
+}
+
+template <typename KeepMerge>
+std::vector<int> SegmentationHierarchy::cut(KeepMerge keepMerge) const {
+    int nodeCount = getNodeCount();
+    std::vector<int> nodeLabel(nodeCount);
+    int next = 0;
+
+    // Pais têm índice maior que os filhos: percorrer do fim garante o pai rotulado.
+    // Nó cuja própria fusão foi descartada não forma região (os filhos formam)
+    for (int node = nodeCount - 1; node >= 0; --node) {
+        int p = parent[node];
+        if (p != -1 && keepMerge(p)) {
+            nodeLabel[node] = nodeLabel[p];
+        } else {
+            nodeLabel[node] = (node < leafCount || keepMerge(node)) ? next++ : -1;
+        }
+    }
+
+    nodeLabel.resize(leafCount);
+    return nodeLabel;
+}
+
+std::vector<int> SegmentationHierarchy::cutAtAltitude(double threshold) const {
+    return cut([&](int node) { return altitude[node] <= threshold; });
+}
+
+std::vector<int> SegmentationHierarchy::cutToRegionCount(int regionCount) const {
+    // Mantém as primeiras (n - regionCount) fusões na ordem de Kruskal
+    int kept = std::max(0, std::min(getMergeCount(), leafCount - regionCount));
+    int firstDropped = leafCount + kept;
+    return cut([&](int node) { return node < firstDropped; });
+}
+
+bool SegmentationHierarchy::save(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    int32_t leaves = leafCount;
+    int32_t nodes = getNodeCount();
+    file.write(HIERARCHY_MAGIC, sizeof(HIERARCHY_MAGIC));
+    file.write(reinterpret_cast<const char*>(&leaves), sizeof(leaves));
+    file.write(reinterpret_cast<const char*>(&nodes), sizeof(nodes));
+    file.write(reinterpret_cast<const char*>(parent.data()), nodes * sizeof(int32_t));
+    file.write(reinterpret_cast<const char*>(altitude.data()), nodes * sizeof(double));
+
+    return file.good();
+}
+
+bool SegmentationHierarchy::load(const std::string& filename, SegmentationHierarchy& hierarchy) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    char magic[sizeof(HIERARCHY_MAGIC)];
+    int32_t leaves = 0;
+    int32_t nodes = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&leaves), sizeof(leaves));
+    file.read(reinterpret_cast<char*>(&nodes), sizeof(nodes));
+
+    if (!file || std::memcmp(magic, HIERARCHY_MAGIC, sizeof(magic)) != 0 ||
+        leaves < 0 || nodes < leaves || nodes > 2 * static_cast<int64_t>(leaves)) {
+        return false;
+    }
+
+    SegmentationHierarchy loaded;
+    loaded.leafCount = leaves;
+    loaded.parent.resize(nodes);
+    loaded.altitude.resize(nodes);
+    file.read(reinterpret_cast<char*>(loaded.parent.data()), nodes * sizeof(int32_t));
+    file.read(reinterpret_cast<char*>(loaded.altitude.data()), nodes * sizeof(double));
+    if (!file) {
+        return false;
+    }
+
+    // Invariante usada pelos cortes: pai sempre com índice maior
+    for (int node = 0; node < nodes; ++node) {
+        int p = loaded.parent[node];
+        if (p != -1 && (p <= node || p >= nodes)) return false;
+    }
+
+    hierarchy = std::move(loaded);
+    return true;
+}
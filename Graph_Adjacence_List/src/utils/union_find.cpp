@@ -1,58 +1,80 @@
-#include "Utils\union_find.h"
+#include "utils/union_find.h"
 #include <algorithm>
 
-UnionFind::UnionFind(int n) {
-    parent.resize(n);
-    rank.resize(n, 0);
-    size.resize(n, 1);
-    internalDiff.resize(n, 0.0);
-    for (int i = 0; i < n; i++) parent[i] = i;
+template <typename Index>
+BasicUnionFind<Index>::BasicUnionFind(Index n) : nodes(n) {
+    for (Index i = 0; i < n; i++) {
+        nodes[i].parent = i;
+        nodes[i].size = 1;
+        nodes[i].internalDiff = 0.0;
+    }
 }
 
-int UnionFind::find(int u) {
-    if (parent[u] != u)
-        parent[u] = find(parent[u]);
-    return parent[u];
+template <typename Index>
+Index BasicUnionFind<Index>::find(Index u) {
+    // Path halving: cada nó visitado passa a apontar para o avô
+    while (nodes[u].parent != u) {
+        Index grandparent = nodes[nodes[u].parent].parent;
+        nodes[u].parent = grandparent;
+        u = grandparent;
+    }
+    return u;
 }
 
-bool UnionFind::join(int u, int v, double weight, double k) {
-    int pu = find(u);
-    int pv = find(v);
+template <typename Index>
+Index BasicUnionFind<Index>::findRoot(Index u) const {
+    while (nodes[u].parent != u) u = nodes[u].parent;
+    return u;
+}
+
+template <typename Index>
+Index BasicUnionFind<Index>::link(Index ru, Index rv, double internal) {
+    if (nodes[ru].size < nodes[rv].size) std::swap(ru, rv);
+    nodes[rv].parent = ru;
+    nodes[ru].size += nodes[rv].size;
+    nodes[ru].internalDiff = internal;
+    return ru;
+}
+
+template <typename Index>
+bool BasicUnionFind<Index>::join(Index u, Index v, double weight, double k) {
+    Index pu = find(u);
+    Index pv = find(v);
     if (pu == pv) return false;
 
-    double minInternal = std::min(internalDiff[pu] + k / size[pu], internalDiff[pv] + k / size[pv]);
+    const Node& a = nodes[pu];
+    const Node& b = nodes[pv];
+    double minInternal = std::min(a.internalDiff + k / a.size, b.internalDiff + k / b.size);
 
     if (weight > minInternal) return false;
 
-    if (rank[pu] < rank[pv]) std::swap(pu, pv);
-    parent[pv] = pu;
-    size[pu] += size[pv];
-    internalDiff[pu] = std::max(weight, std::max(internalDiff[pu], internalDiff[pv]));
-    if (rank[pu] == rank[pv]) rank[pu]++;
-
+    link(pu, pv, std::max(weight, std::max(a.internalDiff, b.internalDiff)));
     return true;
 }
 
-void UnionFind::forceJoin(int u, int v) {
+template <typename Index>
+void BasicUnionFind<Index>::forceJoin(Index u, Index v) {
     u = find(u);
     v = find(v);
     if (u == v) return;
 
-    // Manter a árvore balanceada
-    if (rank[u] < rank[v]) std::swap(u, v);
-
-    parent[v] = u;
-    size[u] += size[v];
-    internalDiff[u] = std::max(internalDiff[u], internalDiff[v]);
+    link(u, v, std::max(nodes[u].internalDiff, nodes[v].internalDiff));
+}
 
-    if (rank[u] == rank[v])
-        rank[u]++;
+template <typename Index>
+Index BasicUnionFind<Index>::getSize(Index u) {
+    return nodes[find(u)].size;
 }
 
-int UnionFind::getSize(int u) {
-    return size[find(u)];
+template <typename Index>
+Index BasicUnionFind<Index>::getRootSize(Index root) const {
+    return nodes[root].size;
 }
 
-double UnionFind::getInternalDiff(int u) {
-    return internalDiff[find(u)];
+template <typename Index>
+double BasicUnionFind<Index>::getInternalDiff(Index u) {
+    return nodes[find(u)].internalDiff;
 }
+
+template class BasicUnionFind<int32_t>;
+template class BasicUnionFind<int64_t>;
@@ -10,7 +10,7 @@
 
 pair<vector<string>, double> Utils::reconstructPath(Graph g, vector<tuple<double, int, int>> d, int from, int to){
 
-    vector<Vertex> vertices = g.getVertices();
+    const vector<Vertex>& vertices = g.getVertices();
     int u = to;
     vector<string> path;
 
@@ -0,0 +1,212 @@
+#include "video_ift_session.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+}
+
+void VideoIFTSession::FrameStats::print() const {
+    std::cout << "=== QUADRO ===" << std::endl;
+    std::cout << "Execução completa: " << (fullRun ? "Sim" : "Não") << std::endl;
+    std::cout << "Pixels alterados: " << changedPixels << std::endl;
+    std::cout << "Pixels invalidados: " << invalidatedPixels << std::endl;
+    std::cout << "Pixels reconquistados: " << reconqueredPixels << std::endl;
+    std::cout << "Tempo: " << executionTimeMs << " ms" << std::endl;
+}
+
+VideoIFTSession::VideoIFTSession(const PathCostFunction& costFunction, int changeThreshold,
+                                 bool eightConnected)
+    : costFunction(costFunction), changeThreshold(changeThreshold), eightConnected(eightConnected),
+      width(0), height(0), lastStats() {}
+
+void VideoIFTSession::reset() {
+    width = 0;
+    height = 0;
+    reference.reset();
+    seedState.clear();
+    forest.reset(0);
+    queue.reset(0);
+}
+
+size_t VideoIFTSession::invalidate(const std::vector<char>& changed, const std::vector<char>& removedRoot,
+                                   std::vector<char>& invalid) const {
+    // 0 = desconhecido, 1 = válido, 2 = inválido
+    int n = width * height;
+    std::vector<char> state(n, 0);
+    std::vector<int> chain;
+    size_t count = 0;
+
+    for (int v = 0; v < n; ++v) {
+        // Sobe pelos predecessores até um pixel de estado conhecido ou uma raiz
+        int u = v;
+        while (state[u] == 0 && !changed[u] && forest.predecessor[u] != -1) {
+            chain.push_back(u);
+            u = forest.predecessor[u];
+        }
+
+        char status = state[u];
+        if (status == 0) {
+            bool bad = changed[u] || (forest.root[u] == u && removedRoot[u]) || !forest.isConquered(u);
+            status = bad ? 2 : 1;
+            state[u] = status;
+        }
+        for (int w : chain) state[w] = status;
+        chain.clear();
+    }
+
+    for (int v = 0; v < n; ++v) {
+        invalid[v] = state[v] == 2;
+        if (invalid[v]) count++;
+    }
+    return count;
+}
+
+size_t VideoIFTSession::conquer() {
+    const Image& image = *reference;
+    int adjacency = eightConnected ? 8 : 4;
+    size_t conquered = 0;
+
+    while (!queue.empty()) {
+        int s = queue.pop();
+        conquered++;
+        int sx = s % width;
+        int sy = s / width;
+        Pixel from(sx, sy, image.getPixelIntensity(sx, sy));
+
+        for (int d = 0; d < adjacency; ++d) {
+            int tx = sx + DX[d];
+            int ty = sy + DY[d];
+            if (tx < 0 || tx >= width || ty < 0 || ty >= height) continue;
+
+            int t = ty * width + tx;
+            if (forest.cost[t] <= forest.cost[s]) continue;
+
+            Pixel to(tx, ty, image.getPixelIntensity(tx, ty));
+            double extended = costFunction.extendCost(forest.cost[s], costFunction.getArcWeight(from, to, image));
+            if (extended < forest.cost[t] || forest.predecessor[t] == s) {
+                forest.cost[t] = extended;
+                forest.predecessor[t] = s;
+                forest.root[t] = forest.root[s];
+                forest.label[t] = forest.label[s];
+                queue.push(t, extended);
+            }
+        }
+    }
+
+    return conquered;
+}
+
+const OptimumPathForest& VideoIFTSession::processFrame(const Image& frame, const SeedSet& seeds) {
+    auto startTime = std::chrono::high_resolution_clock::now();
+    lastStats = FrameStats();
+
+    // Estado das sementes deste quadro (menor handicap vence no mesmo pixel)
+    std::unordered_map<int, std::pair<int, double>> newSeeds;
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        if (!frame.isValidCoordinate(seed.pixel.x, seed.pixel.y)) {
+            throw std::out_of_range("Seed outside image bounds: " + seed.pixel.toString());
+        }
+        int v = seed.pixel.y * frame.getWidth() + seed.pixel.x;
+        double handicap = costFunction.getHandicap(seed.pixel, seeds);
+        auto it = newSeeds.find(v);
+        if (it == newSeeds.end() || handicap < it->second.second) {
+            newSeeds[v] = {seed.label, handicap};
+        }
+    }
+
+    bool fullRun = frame.getWidth() != width || frame.getHeight() != height;
+    int n = frame.getWidth() * frame.getHeight();
+    std::vector<char> invalid;
+
+    if (fullRun) {
+        width = frame.getWidth();
+        height = frame.getHeight();
+        reference = std::make_unique<Image>(frame);
+        forest.reset(n);
+        queue.reset(n);
+        invalid.assign(n, 1);
+        lastStats.changedPixels = n;
+        lastStats.invalidatedPixels = n;
+    } else {
+        // Pixels alterados: a referência só é atualizada onde o limiar foi excedido
+        std::vector<char> changed(n, 0);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int v = y * width + x;
+                uint8_t value = frame.getPixelIntensity(x, y);
+                if (std::abs(value - reference->getPixelIntensity(x, y)) > changeThreshold) {
+                    changed[v] = 1;
+                    reference->setPixelValue(x, y, value);
+                    lastStats.changedPixels++;
+                }
+            }
+        }
+
+        // Raízes cujas sementes sumiram ou mudaram perdem a árvore inteira
+        std::vector<char> removedRoot(n, 0);
+        for (const auto& entry : seedState) {
+            auto it = newSeeds.find(entry.first);
+            if (it == newSeeds.end() || it->second != entry.second) {
+                removedRoot[entry.first] = 1;
+            }
+        }
+
+        invalid.assign(n, 0);
+        lastStats.invalidatedPixels = invalidate(changed, removedRoot, invalid);
+
+        queue.clear();
+        for (int v = 0; v < n; ++v) {
+            if (invalid[v]) {
+                forest.cost[v] = std::numeric_limits<double>::infinity();
+                forest.predecessor[v] = -1;
+                forest.root[v] = -1;
+                forest.label[v] = -1;
+            }
+        }
+
+        // Fronteira: pixels válidos vizinhos da região invalidada
+        int adjacency = eightConnected ? 8 : 4;
+        for (int v = 0; v < n; ++v) {
+            if (!invalid[v]) continue;
+            int x = v % width;
+            int y = v / width;
+            for (int d = 0; d < adjacency; ++d) {
+                int tx = x + DX[d];
+                int ty = y + DY[d];
+                if (tx < 0 || tx >= width || ty < 0 || ty >= height) continue;
+                int t = ty * width + tx;
+                if (!invalid[t] && forest.isConquered(t) && !queue.contains(t)) {
+                    queue.push(t, forest.cost[t]);
+                }
+            }
+        }
+    }
+
+    // Sementes novas, alteradas ou em área invalidada entram como raízes
+    // (a ordem de inserção não importa: o heap desempata pelo índice do pixel)
+    for (const auto& entry : newSeeds) {
+        int v = entry.first;
+        const std::pair<int, double>& state = entry.second;
+        auto previous = seedState.find(v);
+        bool unchanged = previous != seedState.end() && previous->second == state && !invalid[v];
+        if (unchanged || !(state.second < forest.cost[v])) continue;
+
+        forest.cost[v] = state.second;
+        forest.predecessor[v] = -1;
+        forest.root[v] = v;
+        forest.label[v] = state.first;
+        queue.push(v, state.second);
+    }
+    seedState.swap(newSeeds);
+
+    lastStats.fullRun = fullRun;
+    lastStats.reconqueredPixels = conquer();
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    lastStats.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return forest;
+}
@@ -0,0 +1,203 @@
+#include "volume.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+// === VOXEL ===
+
+Voxel Voxel::fromLinearIndex(int64_t index, int width, int height) {
+    int64_t sliceSize = static_cast<int64_t>(width) * height;
+    int z = static_cast<int>(index / sliceSize);
+    int64_t rest = index % sliceSize;
+    return Voxel(static_cast<int>(rest % width), static_cast<int>(rest / width), z, 0);
+}
+
+std::string Voxel::toString() const {
+    std::ostringstream oss;
+    oss << "Voxel(" << x << "," << y << "," << z << "," << static_cast<int>(intensity) << ")";
+    return oss.str();
+}
+
+// === ADJACÊNCIA 3D ===
+
+VolumeAdjacency VolumeAdjacency::create(int connectivity) {
+    if (connectivity != 6 && connectivity != 18 && connectivity != 26) {
+        throw std::invalid_argument("Volume adjacency must be 6, 18 or 26.");
+    }
+
+    // Vizinho entra se o número de coordenadas não nulas couber na conectividade:
+    // 1 -> faces (6), 2 -> arestas (18), 3 -> vértices (26)
+    int maxNonZero = connectivity == 6 ? 1 : (connectivity == 18 ? 2 : 3);
+
+    VolumeAdjacency adjacency;
+    for (int dz = -1; dz <= 1; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                int nonZero = (dx != 0) + (dy != 0) + (dz != 0);
+                if (nonZero == 0 || nonZero > maxNonZero) continue;
+                adjacency.dx.push_back(dx);
+                adjacency.dy.push_back(dy);
+                adjacency.dz.push_back(dz);
+            }
+        }
+    }
+    return adjacency;
+}
+
+// === VOLUME ===
+
+Volume::Volume(int width, int height, int depth, uint8_t defaultValue)
+    : width(width), height(height), depth(depth) {
+    if (width <= 0 || height <= 0 || depth <= 0) {
+        throw std::invalid_argument("Volume dimensions must be positive");
+    }
+    data.assign(static_cast<size_t>(getVoxelCount()), defaultValue);
+}
+
+uint8_t Volume::getVoxelValue(int x, int y, int z) const {
+    if (!isValidCoordinate(x, y, z)) {
+        throw std::out_of_range("Voxel coordinates out of volume bounds");
+    }
+    return data[index(x, y, z)];
+}
+
+void Volume::setVoxelValue(int x, int y, int z, uint8_t value) {
+    if (!isValidCoordinate(x, y, z)) {
+        throw std::out_of_range("Voxel coordinates out of volume bounds");
+    }
+    data[index(x, y, z)] = value;
+}
+
+Voxel Volume::getVoxel(int x, int y, int z) const {
+    return Voxel(x, y, z, getVoxelValue(x, y, z));
+}
+
+Image Volume::getSlice(int z) const {
+    if (z < 0 || z >= depth) {
+        throw std::out_of_range("Slice index out of volume bounds");
+    }
+
+    Image slice(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            slice.setPixelValue(x, y, data[index(x, y, z)]);
+        }
+    }
+    return slice;
+}
+
+void Volume::setSlice(int z, const Image& slice) {
+    if (z < 0 || z >= depth) {
+        throw std::out_of_range("Slice index out of volume bounds");
+    }
+    if (slice.getWidth() != width || slice.getHeight() != height) {
+        throw std::invalid_argument("Slice dimensions do not match the volume");
+    }
+
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            data[index(x, y, z)] = slice.getPixelValue(x, y);
+        }
+    }
+}
+
+Volume Volume::loadRaw(const std::string& filename, int width, int height, int depth) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        throw std::runtime_error("Cannot open volume file: " + filename);
+    }
+
+    Volume volume(width, height, depth);
+    std::streamsize sliceSize = static_cast<std::streamsize>(width) * height;
+    for (int z = 0; z < depth; ++z) {
+        char* slice = reinterpret_cast<char*>(volume.data.data() + volume.index(0, 0, z));
+        if (!file.read(slice, sliceSize)) {
+            throw std::runtime_error("Volume file ended at slice " + std::to_string(z) + ": " + filename);
+        }
+    }
+    return volume;
+}
+
+bool Volume::saveRaw(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::streamsize sliceSize = static_cast<std::streamsize>(width) * height;
+    for (int z = 0; z < depth; ++z) {
+        file.write(reinterpret_cast<const char*>(data.data() + index(0, 0, z)), sliceSize);
+    }
+    return file.good();
+}
+
+namespace {
+    // Próximo token do cabeçalho PGM, ignorando comentários
+    std::string nextHeaderToken(std::istream& in) {
+        std::string token;
+        while (in >> token) {
+            if (token[0] != '#') return token;
+            std::string comment;
+            std::getline(in, comment);
+        }
+        throw std::runtime_error("Truncated PGM header");
+    }
+
+    // Lê uma fatia PGM direto em `out` (width * height bytes)
+    void readPGMSlice(const std::string& filename, int& width, int& height, uint8_t* out) {
+        std::ifstream file(filename, std::ios::binary);
+        if (!file.is_open()) {
+            throw std::runtime_error("Cannot open slice: " + filename);
+        }
+
+        std::string magic = nextHeaderToken(file);
+        int w = std::atoi(nextHeaderToken(file).c_str());
+        int h = std::atoi(nextHeaderToken(file).c_str());
+        int maxValue = std::atoi(nextHeaderToken(file).c_str());
+        if ((magic != "P2" && magic != "P5") || maxValue <= 0 || maxValue > 255) {
+            throw std::runtime_error("Unsupported PGM slice (expected 8-bit P2/P5): " + filename);
+        }
+        if (out == nullptr) {
+            width = w;
+            height = h;
+            return;
+        }
+        if (w != width || h != height) {
+            throw std::runtime_error("Slice dimensions differ from the first slice: " + filename);
+        }
+
+        size_t count = static_cast<size_t>(w) * h;
+        if (magic == "P5") {
+            file.get();  // um único espaço separa o cabeçalho dos dados
+            if (!file.read(reinterpret_cast<char*>(out), count)) {
+                throw std::runtime_error("Truncated PGM slice: " + filename);
+            }
+        } else {
+            for (size_t i = 0; i < count; ++i) {
+                int value;
+                if (!(file >> value)) {
+                    throw std::runtime_error("Truncated PGM slice: " + filename);
+                }
+                out[i] = static_cast<uint8_t>(value);
+            }
+        }
+    }
+}
+
+Volume Volume::loadSlices(const std::vector<std::string>& filenames) {
+    if (filenames.empty()) {
+        throw std::invalid_argument("No slices to load");
+    }
+
+    // Dimensões vêm do cabeçalho da primeira fatia
+    int width = 0;
+    int height = 0;
+    readPGMSlice(filenames[0], width, height, nullptr);
+
+    Volume volume(width, height, static_cast<int>(filenames.size()));
+    for (int z = 0; z < volume.depth; ++z) {
+        readPGMSlice(filenames[z], width, height, volume.data.data() + volume.index(0, 0, z));
+    }
+    return volume;
+}
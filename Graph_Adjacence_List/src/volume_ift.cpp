@@ -0,0 +1,211 @@
+#include "volume_ift.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+int VolumeIFTResult::getLabel(int64_t i) const {
+    int index = label8.empty() ? (label16[i] == 0xFFFF ? -1 : label16[i])
+                               : (label8[i] == 0xFF ? -1 : label8[i]);
+    return index < 0 ? -1 : labelValues[index];
+}
+
+int32_t VolumeIFTResult::getCost(int64_t i) const {
+    if (!cost16.empty()) return cost16[i] == 0xFFFF ? UNREACHED : cost16[i];
+    return cost32[i] == 0xFFFFFFFFu ? UNREACHED : static_cast<int32_t>(cost32[i]);
+}
+
+int64_t VolumeIFTResult::getPredecessor(int64_t i) const {
+    if (predecessor.empty() || predecessor[i] == NO_PREDECESSOR) return -1;
+    int d = predecessor[i];
+    return i - ((static_cast<int64_t>(adjacency.dz[d]) * height + adjacency.dy[d]) * width + adjacency.dx[d]);
+}
+
+Image VolumeIFTResult::getLabelSlice(int z) const {
+    if (z < 0 || z >= depth) {
+        throw std::out_of_range("Slice index out of volume bounds");
+    }
+
+    Image slice(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int value = getLabel(x, y, z);
+            slice.setPixelValue(x, y, static_cast<uint8_t>(std::min(std::max(value, 0), 255)));
+        }
+    }
+    return slice;
+}
+
+size_t VolumeIFTResult::memoryBytes() const {
+    return cost16.size() * sizeof(uint16_t) + cost32.size() * sizeof(uint32_t) +
+           label8.size() * sizeof(uint8_t) + label16.size() * sizeof(uint16_t) +
+           predecessor.size() * sizeof(uint8_t);
+}
+
+int VolumeIFT::buildWeightTable(const PathCostFunction& costFunction, std::vector<int>& table) const {
+    table.assign(256 * 256, 0);
+    Image probe(2, 1);
+    int maxWeight = 0;
+
+    for (int a = 0; a < 256; ++a) {
+        probe.setPixelValue(0, 0, static_cast<uint8_t>(a));
+        for (int b = 0; b < 256; ++b) {
+            probe.setPixelValue(1, 0, static_cast<uint8_t>(b));
+            double w = costFunction.getArcWeight(Pixel(0, 0, a), Pixel(1, 0, b), probe);
+            if (!(w >= 0.0) || w > std::numeric_limits<int32_t>::max() / 2) {
+                throw std::invalid_argument("VolumeIFT requires finite non-negative arc weights.");
+            }
+            int rounded = static_cast<int>(std::lround(w));
+            table[a * 256 + b] = rounded;
+            maxWeight = std::max(maxWeight, rounded);
+        }
+    }
+    return maxWeight;
+}
+
+VolumeIFTResult VolumeIFT::run(const Volume& volume, const PathCostFunction& costFunction,
+                               const std::vector<VoxelSeed>& seeds) const {
+    std::vector<int> weights;
+    int maxWeight = buildWeightTable(costFunction, weights);
+
+    VolumeIFTResult result;
+    result.width = volume.getWidth();
+    result.height = volume.getHeight();
+    result.depth = volume.getDepth();
+    result.adjacency = adjacency;
+
+    int maxHandicap = 0;
+    for (const VoxelSeed& seed : seeds) {
+        const Voxel& v = seed.voxel;
+        if (!volume.isValidCoordinate(v.x, v.y, v.z)) {
+            throw std::out_of_range("Seed outside volume bounds: " + v.toString());
+        }
+        if (seed.handicap < 0 || seed.handicap >= VolumeIFTResult::UNREACHED) continue;
+        maxHandicap = std::max(maxHandicap, seed.handicap);
+        result.labelValues.push_back(seed.label);
+    }
+    std::sort(result.labelValues.begin(), result.labelValues.end());
+    result.labelValues.erase(std::unique(result.labelValues.begin(), result.labelValues.end()),
+                             result.labelValues.end());
+    if (result.labelValues.size() >= 0xFFFF) {
+        throw std::invalid_argument("VolumeIFT supports at most 65534 distinct labels.");
+    }
+
+    // Maior custo possível: composição por máximo (testada em alguns valores)
+    // fica limitada ao maior peso/handicap; senão, o caminho mais longo
+    bool maxComposition = true;
+    for (int a : {0, 1, 7, maxWeight, maxHandicap}) {
+        for (int w : {0, 1, 3, maxWeight}) {
+            if (costFunction.extendCost(a, w) != std::max(a, w)) maxComposition = false;
+        }
+    }
+    double costBound = maxComposition
+        ? std::max(maxHandicap, maxWeight)
+        : maxHandicap + static_cast<double>(std::max<int64_t>(volume.getVoxelCount() - 1, 0)) * maxWeight;
+
+    bool narrowCost = costBound < 0xFFFF;
+    bool narrowLabel = result.labelValues.size() < 0xFF;
+    if (narrowCost && narrowLabel) {
+        propagate(volume, costFunction, weights, maxWeight, seeds, result, result.cost16, result.label8);
+    } else if (narrowCost) {
+        propagate(volume, costFunction, weights, maxWeight, seeds, result, result.cost16, result.label16);
+    } else if (narrowLabel) {
+        propagate(volume, costFunction, weights, maxWeight, seeds, result, result.cost32, result.label8);
+    } else {
+        propagate(volume, costFunction, weights, maxWeight, seeds, result, result.cost32, result.label16);
+    }
+    return result;
+}
+
+template <typename CostT, typename LabelT>
+void VolumeIFT::propagate(const Volume& volume, const PathCostFunction& costFunction,
+                          const std::vector<int>& weights, int maxWeight,
+                          const std::vector<VoxelSeed>& seeds, VolumeIFTResult& result,
+                          std::vector<CostT>& cost, std::vector<LabelT>& label) const {
+    const CostT unreached = std::numeric_limits<CostT>::max();
+    const LabelT unlabeled = std::numeric_limits<LabelT>::max();
+
+    int width = volume.getWidth();
+    int height = volume.getHeight();
+    int depth = volume.getDepth();
+    int64_t n = volume.getVoxelCount();
+
+    cost.assign(n, unreached);
+    label.assign(n, unlabeled);
+    if (keepPredecessors) result.predecessor.assign(n, VolumeIFTResult::NO_PREDECESSOR);
+
+    // Sementes: o menor handicap vence; ordenadas por handicap para a janela circular
+    std::vector<std::pair<int, int64_t>> seedQueue;   // (handicap, índice)
+    for (const VoxelSeed& seed : seeds) {
+        if (seed.handicap < 0 || seed.handicap >= VolumeIFTResult::UNREACHED) continue;
+        const Voxel& v = seed.voxel;
+        int64_t i = volume.index(v.x, v.y, v.z);
+        if (static_cast<int64_t>(seed.handicap) < static_cast<int64_t>(cost[i])) {
+            cost[i] = static_cast<CostT>(seed.handicap);
+            label[i] = static_cast<LabelT>(std::lower_bound(result.labelValues.begin(), result.labelValues.end(),
+                                                            seed.label) - result.labelValues.begin());
+            seedQueue.emplace_back(seed.handicap, i);
+        }
+    }
+    std::stable_sort(seedQueue.begin(), seedQueue.end(),
+        [](const std::pair<int, int64_t>& a, const std::pair<int, int64_t>& b) { return a.first < b.first; });
+
+    // Handicaps distantes entre si não cabem na janela: cada semente entra na
+    // fila quando o custo corrente a alcança, se ainda não foi conquistada por
+    // um caminho mais barato (ou substituída por outra semente no mesmo voxel)
+    CircularBucketQueue queue(maxWeight);
+    size_t nextSeed = 0;
+    auto admitSeeds = [&](int upTo) {
+        for (; nextSeed < seedQueue.size() && seedQueue[nextSeed].first <= upTo; ++nextSeed) {
+            int handicap = seedQueue[nextSeed].first;
+            int64_t i = seedQueue[nextSeed].second;
+            if (static_cast<int64_t>(cost[i]) == handicap) queue.push(i, handicap);
+        }
+    };
+
+    const std::vector<uint8_t>& data = volume.getData();
+    int k = adjacency.size();
+    int64_t sliceSize = static_cast<int64_t>(width) * height;
+
+    while (nextSeed < seedQueue.size() || !queue.empty()) {
+        if (queue.empty()) {
+            admitSeeds(seedQueue[nextSeed].first);
+            if (queue.empty()) continue;
+        }
+
+        int64_t s = queue.pop();
+        int current = queue.getMinCost();
+        admitSeeds(current + maxWeight);
+        if (static_cast<int64_t>(cost[s]) != current) continue;  // entrada obsoleta
+
+        int sx = static_cast<int>(s % width);
+        int sy = static_cast<int>((s / width) % height);
+        int sz = static_cast<int>(s / sliceSize);
+        const int* row = weights.data() + data[s] * 256;
+
+        for (int d = 0; d < k; ++d) {
+            int tx = sx + adjacency.dx[d];
+            int ty = sy + adjacency.dy[d];
+            int tz = sz + adjacency.dz[d];
+            if (tx < 0 || tx >= width || ty < 0 || ty >= height || tz < 0 || tz >= depth) continue;
+
+            int64_t t = (static_cast<int64_t>(tz) * height + ty) * width + tx;
+            if (static_cast<int64_t>(cost[t]) <= current) continue;
+
+            double extended = costFunction.extendCost(current, row[data[t]]);
+            if (extended >= static_cast<double>(cost[t])) continue;
+            if (extended >= static_cast<double>(unreached) || extended >= VolumeIFTResult::UNREACHED) {
+                throw std::runtime_error("VolumeIFT: path cost exceeds the cost storage range.");
+            }
+
+            int newCost = static_cast<int>(std::lround(extended));
+            if (newCost < current || newCost - current > maxWeight) {
+                throw std::runtime_error("VolumeIFT: path-cost function is not monotonic-incremental.");
+            }
+
+            cost[t] = static_cast<CostT>(newCost);
+            label[t] = label[s];
+            if (keepPredecessors) result.predecessor[t] = static_cast<uint8_t>(d);
+            queue.push(t, newCost);
+        }
+    }
+}
@@ -0,0 +1,165 @@
+#include "watershed.h"
+#include "bucket_queue.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace {
+    // Relevo no índice p da grade com moldura de 1 pixel (borda replicada),
+    // então a vizinhança 3x3 nunca sai da grade
+    inline uint8_t sampleRelief(const std::vector<uint8_t>& padded, int p, int stride,
+                                WatershedTransform::Relief relief) {
+        if (relief == WatershedTransform::Relief::Image) return padded[p];
+
+        const uint8_t* up = &padded[p - stride];
+        const uint8_t* mid = &padded[p];
+        const uint8_t* down = &padded[p + stride];
+
+        if (relief == WatershedTransform::Relief::Sobel) {
+            int gx = (up[1] + 2 * mid[1] + down[1]) - (up[-1] + 2 * mid[-1] + down[-1]);
+            int gy = (down[-1] + 2 * down[0] + down[1]) - (up[-1] + 2 * up[0] + up[1]);
+            return static_cast<uint8_t>((std::abs(gx) + std::abs(gy)) >> 3);
+        }
+
+        uint8_t lo = 255, hi = 0;
+        for (const uint8_t* row : {up, mid, down}) {
+            for (int c = -1; c <= 1; ++c) {
+                lo = std::min(lo, row[c]);
+                hi = std::max(hi, row[c]);
+            }
+        }
+        return static_cast<uint8_t>(hi - lo);
+    }
+}
+
+WatershedTransform::Result WatershedTransform::run(const Image& image, const SeedSet& markers) const {
+    auto startTime = std::chrono::high_resolution_clock::now();
+
+    int width = image.getWidth();
+    int height = image.getHeight();
+    size_t n = static_cast<size_t>(width) * height;
+
+    // Grade com moldura: pixels da moldura já contam como enfileirados, o que
+    // dispensa testes de limite no laço principal
+    int stride = width + 2;
+    size_t paddedSize = static_cast<size_t>(stride) * (height + 2);
+    std::vector<uint8_t> padded(paddedSize);
+    std::vector<std::vector<uint8_t>> data = image.getRawData();
+    for (int y = -1; y <= height; ++y) {
+        const std::vector<uint8_t>& row = data[std::min(std::max(y, 0), height - 1)];
+        uint8_t* out = &padded[static_cast<size_t>(y + 1) * stride];
+        std::copy(row.begin(), row.end(), out + 1);
+        out[0] = row[0];
+        out[width + 1] = row[width - 1];
+    }
+
+    std::vector<uint8_t> queued(paddedSize, 1);
+    std::vector<int> labels(paddedSize, -1);
+    std::vector<uint8_t> costs(paddedSize, 0);
+    for (int y = 1; y <= height; ++y) {
+        std::fill(queued.begin() + static_cast<size_t>(y) * stride + 1,
+                  queued.begin() + static_cast<size_t>(y) * stride + 1 + width, 0);
+    }
+
+    int offsets[8];
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    for (int d = 0; d < 8; ++d) offsets[d] = DY[d] * stride + DX[d];
+    int adjacency = eightConnected ? 8 : 4;
+
+    CircularBucketQueue queue(255);
+    size_t linePixels = 0;
+
+    // Marcadores em ordem de custo: a janela da fila começa no menor deles
+    std::vector<std::pair<int, int>> roots;
+    for (const Seed& seed : markers.getActiveSeeds()) {
+        const Pixel& p = seed.pixel;
+        if (!image.isValidCoordinate(p.x, p.y)) {
+            throw std::out_of_range("Marker outside image bounds: " + p.toString());
+        }
+        if (watershedLines && seed.label <= 0) {
+            throw std::invalid_argument("Marker labels must be positive when watershed lines are enabled: " +
+                                        std::to_string(seed.label));
+        }
+        int v = (p.y + 1) * stride + p.x + 1;
+        if (queued[v]) continue;
+        queued[v] = 1;
+        labels[v] = seed.label;
+        costs[v] = sampleRelief(padded, v, stride, relief);
+        roots.push_back(std::make_pair(static_cast<int>(costs[v]), v));
+    }
+    std::stable_sort(roots.begin(), roots.end(),
+                     [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                         return a.first < b.first;
+                     });
+    for (const auto& root : roots) queue.push(root.second, root.first);
+
+    while (!queue.empty()) {
+        int v = static_cast<int>(queue.pop());
+        int level = queue.getMinCost();
+
+        // Linhas (Meyer): rótulo decidido na saída a partir dos vizinhos já rotulados
+        if (watershedLines && labels[v] == -1) {
+            int label = -1;
+            bool conflict = false;
+            for (int d = 0; d < adjacency && !conflict; ++d) {
+                int neighborLabel = labels[v + offsets[d]];
+                if (neighborLabel <= 0) continue;
+                if (label == -1) label = neighborLabel;
+                else if (neighborLabel != label) conflict = true;
+            }
+            if (conflict) {
+                labels[v] = 0;
+                linePixels++;
+                continue;
+            }
+            labels[v] = label;
+        }
+
+        for (int d = 0; d < adjacency; ++d) {
+            int u = v + offsets[d];
+            if (queued[u]) continue;
+            queued[u] = 1;
+
+            // f_max: o primeiro custo oferecido é ótimo, cada pixel entra uma vez
+            int cost = std::max<int>(level, sampleRelief(padded, u, stride, relief));
+            costs[u] = static_cast<uint8_t>(cost);
+            if (!watershedLines) labels[u] = labels[v];
+            queue.push(u, cost);
+        }
+    }
+
+    Result result;
+    result.width = width;
+    result.height = height;
+    result.labels.resize(n);
+    result.costs.resize(n);
+    result.linePixels = linePixels;
+    for (int y = 0; y < height; ++y) {
+        size_t from = static_cast<size_t>(y + 1) * stride + 1;
+        std::copy(labels.begin() + from, labels.begin() + from + width,
+                  result.labels.begin() + static_cast<size_t>(y) * width);
+        std::copy(costs.begin() + from, costs.begin() + from + width,
+                  result.costs.begin() + static_cast<size_t>(y) * width);
+    }
+
+    auto endTime = std::chrono::high_resolution_clock::now();
+    result.executionTimeMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    return result;
+}
+
+std::unique_ptr<IFTResult> WatershedTransform::Result::toIFTResult(const Image& image) const {
+    auto ift = std::make_unique<IFTResult>(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            Pixel pixel(x, y, image.getPixelIntensity(x, y));
+            ift->setCost(pixel, costs[v]);
+            if (labels[v] != -1) {
+                ift->setLabel(pixel, labels[v]);
+            }
+        }
+    }
+    return ift;
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "distance_transform.h"
+#include <random>
+
+namespace {
+    // Distância ao quadrado até a semente mais próxima, por força bruta
+    std::vector<int64_t> bruteForce(int width, int height, const std::vector<Pixel>& seeds) {
+        std::vector<int64_t> result(static_cast<size_t>(width) * height, -1);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int64_t best = -1;
+                for (const Pixel& p : seeds) {
+                    int64_t dx = x - p.x, dy = y - p.y;
+                    if (best < 0 || dx * dx + dy * dy < best) best = dx * dx + dy * dy;
+                }
+                result[static_cast<size_t>(y) * width + x] = best;
+            }
+        }
+        return result;
+    }
+
+    void check(int width, int height, const std::vector<Pixel>& pixels) {
+        SeedSet seeds;
+        for (size_t i = 0; i < pixels.size(); ++i) seeds.addSeed(pixels[i], static_cast<int>(i) + 1);
+        std::vector<int64_t> expected = bruteForce(width, height, pixels);
+
+        for (auto method : {DistanceTransform::Method::Separable, DistanceTransform::Method::IFT}) {
+            OptimumPathForest forest = DistanceTransform::compute(width, height, seeds, method);
+            std::vector<int64_t> squared = DistanceTransform::squaredDistances(forest, width);
+            for (size_t v = 0; v < expected.size(); ++v) {
+                ASSERT_EQ(squared[v], expected[v]) << width << "x" << height << ", " << pixels.size()
+                                                   << " seeds, pixel " << v;
+                EXPECT_DOUBLE_EQ(forest.cost[v], std::sqrt(static_cast<double>(expected[v])));
+                EXPECT_EQ(forest.label[v], forest.label[forest.root[v]]);
+            }
+        }
+    }
+
+    void checkRandom(std::mt19937& rng, int width, int height, int seedCount) {
+        std::vector<Pixel> pixels;
+        for (int i = 0; i < seedCount; ++i) pixels.push_back(Pixel(rng() % width, rng() % height, 0));
+        check(width, height, pixels);
+    }
+}
+
+TEST(DistanceTransformTest, MatchesBruteForceOnRandomSeeds) {
+    std::mt19937 rng(43);
+    for (int trial = 0; trial < 40; ++trial) {
+        int width = 5 + rng() % 60, height = 5 + rng() % 60;
+        checkRandom(rng, width, height, 1 + rng() % (width * height / 8 + 1));
+    }
+}
+
+TEST(DistanceTransformTest, IFTCorrectsEightNeighbourFailures) {
+    // Configurações (achadas por busca aleatória) em que propagar a raiz só
+    // pela vizinhança-8 deixa pixels com uma raiz que não é a mais próxima
+    check(29, 28, {Pixel(26, 12, 0), Pixel(23, 11, 0), Pixel(26, 19, 0), Pixel(19, 6, 0)});
+    check(88, 98, {Pixel(58, 36, 0), Pixel(53, 39, 0), Pixel(80, 30, 0), Pixel(44, 18, 0)});
+    check(27, 27, {Pixel(23, 23, 0), Pixel(21, 8, 0), Pixel(16, 2, 0), Pixel(26, 11, 0)});
+}
+
+TEST(DistanceTransformTest, MatchesBruteForceOnLargeSparseSeeds) {
+    // Poucas sementes distantes: células de Voronoi grandes e longas
+    std::mt19937 rng(44);
+    for (int trial = 0; trial < 6; ++trial) {
+        checkRandom(rng, 300 + rng() % 200, 200 + rng() % 200, 2 + rng() % 7);
+    }
+}
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+#include "utils/edge_sort.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+namespace {
+    typedef EdgeSort::WeightedEdge WeightedEdge;
+
+    // Arestas com poucos pesos distintos (muitos empates) e vértices aleatórios
+    std::vector<WeightedEdge> randomEdges(std::mt19937& rng, size_t count, int vertices, int weightCount) {
+        std::vector<WeightedEdge> edges;
+        for (size_t i = 0; i < count; ++i) {
+            int u = static_cast<int>(rng() % vertices), v = static_cast<int>(rng() % vertices);
+            edges.push_back(WeightedEdge(double(rng() % weightCount), std::min(u, v), std::max(u, v)));
+        }
+        return edges;
+    }
+
+    void expectSameAsStdSort(std::vector<WeightedEdge> edges, unsigned threads) {
+        std::vector<WeightedEdge> expected = edges;
+        std::sort(expected.begin(), expected.end());
+        EdgeSort::sortEdges(edges, threads);
+        EXPECT_EQ(edges, expected);
+    }
+}
+
+TEST(EdgeSortTest, IntegerWeightsMatchStdSort) {
+    std::mt19937 rng(26);
+    std::vector<WeightedEdge> edges = randomEdges(rng, 5000, 300, 20);
+
+    std::vector<uint32_t> keys;
+    uint32_t maxKey = 0;
+    ASSERT_TRUE(EdgeSort::computeIntegerKeys(edges, keys, maxKey));
+    EXPECT_EQ(maxKey, 19u);
+
+    expectSameAsStdSort(edges, 1);
+}
+
+TEST(EdgeSortTest, SquareRootWeightsMatchStdSort) {
+    // Pesos de rgbDistance: raízes de inteiros
+    std::mt19937 rng(126);
+    std::vector<WeightedEdge> edges = randomEdges(rng, 5000, 300, 50);
+    for (auto& edge : edges) std::get<0>(edge) = std::sqrt(std::get<0>(edge) * 7.0);
+
+    std::vector<uint32_t> keys;
+    uint32_t maxKey = 0;
+    ASSERT_TRUE(EdgeSort::computeIntegerKeys(edges, keys, maxKey));
+
+    expectSameAsStdSort(edges, 1);
+}
+
+TEST(EdgeSortTest, RealWeightsFallBackToStdSort) {
+    std::mt19937 rng(226);
+    std::vector<WeightedEdge> edges = randomEdges(rng, 3000, 200, 10);
+    for (auto& edge : edges) std::get<0>(edge) = std::get<0>(edge) / 3.0 + 0.25;
+
+    std::vector<uint32_t> keys;
+    uint32_t maxKey = 0;
+    EXPECT_FALSE(EdgeSort::computeIntegerKeys(edges, keys, maxKey));
+    expectSameAsStdSort(edges, 1);
+
+    // Vértices negativos não cabem nos registros: também caem no std::sort
+    edges = randomEdges(rng, 1000, 50, 10);
+    std::get<1>(edges[10]) = -3;
+    expectSameAsStdSort(edges, 1);
+}
+
+TEST(EdgeSortTest, ThreadedHistogramMatchesStdSort) {
+    // Acima de 2 x 2^14 registros: vários blocos de histograma por passada
+    std::mt19937 rng(326);
+    std::vector<WeightedEdge> edges = randomEdges(rng, 100000, 5000, 3000);
+    expectSameAsStdSort(edges, 1);
+    expectSameAsStdSort(edges, 4);
+
+    std::vector<uint64_t> records(100000);
+    for (uint64_t& r : records) r = (uint64_t(rng() % 100000) << 20) | (rng() & 0xFFFFF);
+    std::vector<uint64_t> expected = records;
+    std::stable_sort(expected.begin(), expected.end(), [](uint64_t a, uint64_t b) { return (a >> 20) < (b >> 20); });
+
+    std::vector<uint64_t> threaded = records;
+    EdgeSort::radixSortRecords(records, 20, 17, 1);
+    EdgeSort::radixSortRecords(threaded, 20, 17, 4);
+    EXPECT_EQ(records, expected);
+    EXPECT_EQ(threaded, expected);
+}
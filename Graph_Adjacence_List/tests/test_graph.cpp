@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include "Directed_Graph.h"
+#include "graph_ift.h"
 #include <algorithm> 
 
 TEST(GraphTest, AddVertexIncreasesLength) {
@@ -105,3 +106,48 @@ TEST(GraphTest, AddAfterRemoveWithSameLabelCreatesNewEntry) {
     EXPECT_TRUE(neighbors.empty());
 }
 
+TEST(GraphTest, GraphIFTAssignsEachVertexToNearestSource) {
+    DirectedGraph g;
+    for (const std::string label : {"A", "B", "C", "D", "E"}) g.addVertex(label);
+
+    g.addEdge("A", "B", 1.0);
+    g.addEdge("B", "C", 5.0);
+    g.addEdge("E", "D", 1.0);
+    g.addEdge("D", "C", 2.0);
+    g.addEdge("C", "B", 1.0);
+
+    auto costFunction = createConstantSum();
+    GraphIFT ift(g);
+    const OptimumPathForest& forest = ift.run(*costFunction, {
+        GraphIFT::seedAt(g, "A", 1),
+        GraphIFT::seedAt(g, "E", 2)
+    });
+
+    auto index = g.getLabeltoIndex();
+    EXPECT_EQ(forest.label[index["B"]], 1);
+    EXPECT_EQ(forest.label[index["C"]], 2);
+    EXPECT_DOUBLE_EQ(forest.cost[index["C"]], 3.0);
+    EXPECT_EQ(forest.root[index["C"]], index["E"]);
+
+    std::vector<int> expected = {index["E"], index["D"], index["C"]};
+    EXPECT_EQ(forest.path(index["C"]), expected);
+
+    EXPECT_EQ(GraphIFT::seedAt(g, "D", 3, 1.5).vertex, index["D"]);
+    EXPECT_THROW(GraphIFT::seedAt(g, "Z", 1), std::invalid_argument);
+}
+
+TEST(GraphTest, GraphIFTLeavesUnreachableVerticesUnconquered) {
+    DirectedGraph g;
+    g.addVertex("A");
+    g.addVertex("B");
+    g.addEdge("B", "A", 1.0);
+
+    auto costFunction = createConstantMax();
+    GraphIFT ift(g);
+    const OptimumPathForest& forest = ift.run(*costFunction, {GraphIFT::seedAt(g, "A", 7)});
+
+    EXPECT_FALSE(forest.isConquered(1));
+    EXPECT_EQ(forest.label[1], -1);
+    EXPECT_TRUE(forest.path(1).empty());
+    EXPECT_THROW(GraphIFT::seedAt(g, "Z", 1), std::invalid_argument);
+}
@@ -0,0 +1,186 @@
+#include <gtest/gtest.h>
+#include "grid_graph_cut.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <queue>
+#include <random>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+
+    // Rede do corte com as mesmas capacidades inteiras do GridGraphCut
+    // (sigma explícito), em matriz densa: nós 0..n-1, fonte n, sumidouro n+1
+    struct Network {
+        int n;
+        std::vector<std::vector<int64_t>> capacity;
+        std::vector<std::vector<int64_t>> nlink;   // só arestas entre pixels
+    };
+
+    Network buildNetwork(const Image& image, const SeedSet& seeds, double lambda, double sigma, bool eight) {
+        int width = image.getWidth(), height = image.getHeight();
+        Network net;
+        net.n = width * height;
+        net.capacity.assign(net.n + 2, std::vector<int64_t>(net.n + 2, 0));
+
+        auto weight = [&](int diff, bool diagonal) {
+            double b = lambda * std::exp(-(diff * diff) / (2.0 * sigma * sigma));
+            return static_cast<int64_t>(std::lround(diagonal ? b / std::sqrt(2.0) : b));
+        };
+
+        int adjacency = eight ? 8 : 4;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                for (int d = 0; d < adjacency; ++d) {
+                    int nx = x + DX[d], ny = y + DY[d];
+                    if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                    int diff = std::abs(image.getPixelValue(x, y) - image.getPixelValue(nx, ny));
+                    net.capacity[y * width + x][ny * width + nx] = weight(diff, d >= 4);
+                }
+            }
+        }
+        net.nlink = net.capacity;
+
+        int64_t terminal = 1 + 4 * weight(0, false) + (eight ? 4 * weight(0, true) : 0);
+        for (const Seed& seed : seeds.getActiveSeeds()) {
+            int v = seed.pixel.y * width + seed.pixel.x;
+            if (seed.label == 1) net.capacity[net.n][v] = terminal;
+            else net.capacity[v][net.n + 1] = terminal;
+        }
+        return net;
+    }
+
+    // Edmonds-Karp: caminhos aumentantes mais curtos por BFS
+    int64_t edmondsKarp(Network net) {
+        int source = net.n, sink = net.n + 1, count = net.n + 2;
+        int64_t flow = 0;
+        while (true) {
+            std::vector<int> parent(count, -1);
+            parent[source] = source;
+            std::queue<int> queue;
+            queue.push(source);
+            while (!queue.empty() && parent[sink] == -1) {
+                int v = queue.front();
+                queue.pop();
+                for (int u = 0; u < count; ++u) {
+                    if (parent[u] == -1 && net.capacity[v][u] > 0) {
+                        parent[u] = v;
+                        queue.push(u);
+                    }
+                }
+            }
+            if (parent[sink] == -1) return flow;
+
+            int64_t bottleneck = INT64_MAX;
+            for (int v = sink; v != source; v = parent[v]) {
+                bottleneck = std::min(bottleneck, net.capacity[parent[v]][v]);
+            }
+            for (int v = sink; v != source; v = parent[v]) {
+                net.capacity[parent[v]][v] -= bottleneck;
+                net.capacity[v][parent[v]] += bottleneck;
+            }
+            flow += bottleneck;
+        }
+    }
+
+    // Custo do corte dado pela máscara, recalculado na rede original
+    int64_t cutOf(const Network& net, const std::vector<uint8_t>& mask) {
+        int64_t cost = 0;
+        for (int v = 0; v < net.n; ++v) {
+            if (mask[v]) {
+                cost += net.capacity[v][net.n + 1];
+                for (int u = 0; u < net.n; ++u) {
+                    if (!mask[u]) cost += net.nlink[v][u];
+                }
+            } else {
+                cost += net.capacity[net.n][v];
+            }
+        }
+        return cost;
+    }
+
+    Image randomImage(std::mt19937& rng, int width, int height) {
+        // Disco claro sobre fundo escuro, com ruído
+        Image image(width, height);
+        double cx = width / 2.0, cy = height / 2.0, r = std::min(width, height) / 3.0;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                bool inside = (x - cx) * (x - cx) + (y - cy) * (y - cy) < r * r;
+                image.setPixelValue(x, y, (inside ? 170 : 60) + rng() % 60);
+            }
+        }
+        return image;
+    }
+
+    SeedSet randomSeeds(std::mt19937& rng, const Image& image, int count) {
+        SeedSet seeds;
+        int width = image.getWidth(), height = image.getHeight();
+        for (int i = 0; i < count; ++i) {
+            Pixel p = image.getPixel(rng() % width, rng() % height);
+            if (!seeds.isSeed(p)) seeds.addSeed(p, image.getPixelValue(p.x, p.y) >= 170 ? 1 : 2);
+        }
+        return seeds;
+    }
+
+    void expectMinimumCut(const GridGraphCut::Result& result, const Image& image, const SeedSet& seeds,
+                          double lambda, double sigma, bool eight) {
+        Network net = buildNetwork(image, seeds, lambda, sigma, eight);
+        int64_t expected = edmondsKarp(net);
+        EXPECT_EQ(result.cutCost, expected);
+        EXPECT_EQ(cutOf(net, result.mask), expected);
+        for (const Seed& seed : seeds.getActiveSeeds()) {
+            EXPECT_EQ(result.mask[seed.pixel.y * image.getWidth() + seed.pixel.x], seed.label == 1 ? 1 : 0);
+        }
+    }
+}
+
+TEST(GridGraphCutTest, CutCostMatchesEdmondsKarp) {
+    std::mt19937 rng(47);
+    const double lambda = 50.0, sigma = 30.0;
+    for (bool eight : {false, true}) {
+        for (int trial = 0; trial < 6; ++trial) {
+            int width = 4 + rng() % 10, height = 4 + rng() % 10;
+            Image image = randomImage(rng, width, height);
+            SeedSet seeds = randomSeeds(rng, image, 2 + rng() % 6);
+
+            GridGraphCut cut(lambda, sigma, eight);
+            GridGraphCut::Result result = cut.segment(image, seeds);
+            expectMinimumCut(result, image, seeds, lambda, sigma, eight);
+            EXPECT_EQ(result.flow, result.cutCost);
+        }
+    }
+}
+
+TEST(GridGraphCutTest, UpdateSeedsMatchesEdmondsKarp) {
+    std::mt19937 rng(147);
+    const double lambda = 50.0, sigma = 30.0;
+    for (bool eight : {false, true}) {
+        for (int trial = 0; trial < 6; ++trial) {
+            int width = 4 + rng() % 10, height = 4 + rng() % 10;
+            Image image = randomImage(rng, width, height);
+            SeedSet seeds = randomSeeds(rng, image, 2 + rng() % 6);
+
+            GridGraphCut cut(lambda, sigma, eight);
+            cut.segment(image, seeds);
+
+            // Várias edições seguidas: sementes novas, removidas e com o lado trocado
+            for (int edit = 0; edit < 4; ++edit) {
+                SeedSet next;
+                for (const Seed& seed : seeds.getActiveSeeds()) {
+                    int choice = rng() % 4;
+                    if (choice == 0) continue;
+                    next.addSeed(seed.pixel, choice == 1 ? 3 - seed.label : seed.label);
+                }
+                for (const Seed& seed : randomSeeds(rng, image, 1 + rng() % 3).getActiveSeeds()) {
+                    if (!next.isSeed(seed.pixel)) next.addSeed(seed.pixel, seed.label);
+                }
+                seeds = next;
+
+                GridGraphCut::Result result = cut.updateSeeds(seeds);
+                expectMinimumCut(result, image, seeds, lambda, sigma, eight);
+                EXPECT_EQ(result.cutCost, GridGraphCut(lambda, sigma, eight).segment(image, seeds).cutCost);
+            }
+        }
+    }
+}
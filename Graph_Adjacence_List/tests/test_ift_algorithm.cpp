@@ -0,0 +1,314 @@
+#include <gtest/gtest.h>
+#include "ift_algorithm.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+
+    // Dijkstra com a mesma função de custo, restrito ao retângulo
+    // [x0, x0 + w) x [y0, y0 + h) (sementes fora dele são ignoradas) e,
+    // opcionalmente, às sementes de um rótulo. Custos indexados pela imagem inteira
+    std::vector<double> dijkstra(const Image& image, const PathCostFunction& costFunction, const SeedSet& seeds,
+                                 bool eightConnected, int x0, int y0, int w, int h, int onlyLabel = -1) {
+        int width = image.getWidth();
+        std::vector<double> cost(static_cast<size_t>(width) * image.getHeight(), INF);
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> queue;
+        auto inside = [&](int x, int y) { return x >= x0 && x < x0 + w && y >= y0 && y < y0 + h; };
+
+        for (const Seed& seed : seeds.getActiveSeeds()) {
+            if (!inside(seed.pixel.x, seed.pixel.y) || (onlyLabel != -1 && seed.label != onlyLabel)) continue;
+            int v = seed.pixel.y * width + seed.pixel.x;
+            double handicap = costFunction.getHandicap(image.getPixel(seed.pixel.x, seed.pixel.y), seeds);
+            if (handicap < cost[v]) {
+                cost[v] = handicap;
+                queue.push({handicap, v});
+            }
+        }
+
+        int k = eightConnected ? 8 : 4;
+        while (!queue.empty()) {
+            auto [c, v] = queue.top();
+            queue.pop();
+            if (c != cost[v]) continue;
+            Pixel current = image.getPixel(v % width, v / width);
+            for (int d = 0; d < k; ++d) {
+                int nx = current.x + DX[d], ny = current.y + DY[d];
+                if (!inside(nx, ny)) continue;
+                double extended = costFunction.extendCost(c, costFunction.getArcWeight(current, image.getPixel(nx, ny), image));
+                int u = ny * width + nx;
+                if (extended < cost[u]) {
+                    cost[u] = extended;
+                    queue.push({extended, u});
+                }
+            }
+        }
+        return cost;
+    }
+
+    // Rótulo único de custo ótimo em v, ou -1 se dois rótulos empatam
+    int uniqueLabel(const std::vector<std::vector<double>>& perLabel, const std::vector<int>& labels,
+                    const std::vector<double>& expected, size_t v) {
+        int found = -1;
+        for (size_t i = 0; i < labels.size(); ++i) {
+            if (perLabel[i][v] != expected[v]) continue;
+            if (found != -1) return -1;
+            found = labels[i];
+        }
+        return found;
+    }
+
+    Image randomImage(std::mt19937& rng, int width, int height) {
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) image.setPixelValue(x, y, static_cast<uint8_t>((x / 6 + y / 5) % 4 * 50 + rng() % 9));
+        }
+        return image;
+    }
+
+    SeedSet randomSeeds(std::mt19937& rng, const Image& image, int labels) {
+        SeedSet seeds;
+        for (int label = 1; label <= labels; ++label) {
+            for (int i = 0; i < 2; ++i) {
+                Pixel p = image.getPixel(rng() % image.getWidth(), rng() % image.getHeight());
+                if (!seeds.isSeed(p)) seeds.addSeed(p, label, static_cast<double>(rng() % 5));
+            }
+        }
+        return seeds;
+    }
+
+    std::vector<int> labelsOf(const SeedSet& seeds) {
+        std::set<int> distinct;
+        for (const Seed& seed : seeds.getActiveSeeds()) distinct.insert(seed.label);
+        return std::vector<int>(distinct.begin(), distinct.end());
+    }
+}
+
+TEST(IFTAlgorithmTest, BoundedIFTMatchesRestrictedDijkstra) {
+    std::mt19937 rng(40);
+    auto costFunction = createIntensityDifferenceSum();
+    for (bool eight : {false, true}) {
+        for (double maxCost : {0.0, 15.0, 60.0, 400.0, INF}) {
+            int width = 20 + rng() % 30, height = 20 + rng() % 30;
+            Image image = randomImage(rng, width, height);
+            SeedSet seeds = randomSeeds(rng, image, 3);
+
+            std::vector<double> expected = dijkstra(image, *costFunction, seeds, eight, 0, 0, width, height);
+            std::vector<int> labels = labelsOf(seeds);
+            std::vector<std::vector<double>> perLabel;
+            for (int label : labels) {
+                perLabel.push_back(dijkstra(image, *costFunction, seeds, eight, 0, 0, width, height, label));
+            }
+
+            IFTAlgorithm ift(eight);
+            auto result = ift.runIFTBounded(image, *costFunction, seeds, maxCost);
+
+            // Conquistados = exatamente os pixels com custo ótimo <= maxCost
+            size_t conquered = 0;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    size_t v = static_cast<size_t>(y) * width + x;
+                    bool reached = expected[v] <= maxCost;
+                    ASSERT_EQ(result->isConquered(x, y), reached) << "pixel (" << x << ", " << y << ")";
+                    if (!reached) {
+                        EXPECT_EQ(result->getCost(x, y), INF);
+                        EXPECT_EQ(result->getLabel(x, y), -1);
+                        continue;
+                    }
+                    conquered++;
+                    EXPECT_EQ(result->getCost(x, y), expected[v]) << "pixel (" << x << ", " << y << ")";
+                    int label = uniqueLabel(perLabel, labels, expected, v);
+                    if (label != -1) {
+                        EXPECT_EQ(result->getLabel(x, y), label);
+                    }
+                }
+            }
+            EXPECT_EQ(result->getConqueredPixels().size(), conquered);
+
+            // Ordem de conquista = custos não decrescentes
+            const std::vector<Pixel>& order = result->getConqueredPixels();
+            for (size_t i = 1; i < order.size(); ++i) {
+                EXPECT_LE(result->getCost(order[i - 1].x, order[i - 1].y), result->getCost(order[i].x, order[i].y));
+            }
+        }
+    }
+}
+
+TEST(IFTAlgorithmTest, SparseResultConvertsToIFTResult) {
+    std::mt19937 rng(140);
+    auto costFunction = createIntensityDifferenceSum();
+    int width = 37, height = 29;
+    Image image = randomImage(rng, width, height);
+    SeedSet seeds = randomSeeds(rng, image, 2);
+
+    IFTAlgorithm ift(true);
+    auto sparse = ift.runIFTBounded(image, *costFunction, seeds, 80.0);
+    auto full = sparse->toIFTResult(image);
+    ASSERT_GT(sparse->getConqueredPixels().size(), 50u);
+    ASSERT_LT(sparse->getConqueredPixels().size(), static_cast<size_t>(width) * height);
+
+    EXPECT_EQ(full->getProcessedPixelCount(), sparse->getConqueredPixels().size());
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            Pixel pixel = image.getPixel(x, y);
+            EXPECT_EQ(full->getCost(pixel), sparse->getCost(x, y));
+            EXPECT_EQ(full->getLabel(pixel), sparse->getLabel(x, y));
+            ASSERT_EQ(full->hasPredecessor(pixel), sparse->hasPredecessor(x, y));
+            if (!sparse->hasPredecessor(x, y)) continue;
+
+            // Predecessor vizinho, conquistado, com o arco que dá o custo de pixel
+            Pixel predecessor = full->getPredecessor(pixel);
+            EXPECT_EQ(predecessor.x, sparse->getPredecessor(x, y).x);
+            EXPECT_EQ(predecessor.y, sparse->getPredecessor(x, y).y);
+            EXPECT_EQ(predecessor.intensity, image.getPixelIntensity(predecessor.x, predecessor.y));
+            EXPECT_LE(std::max(std::abs(predecessor.x - x), std::abs(predecessor.y - y)), 1);
+            EXPECT_TRUE(sparse->isConquered(predecessor.x, predecessor.y));
+            EXPECT_EQ(costFunction->extendCost(full->getCost(predecessor),
+                                               costFunction->getArcWeight(predecessor, pixel, image)),
+                      full->getCost(pixel));
+        }
+    }
+}
+
+TEST(IFTAlgorithmTest, BoundedIFTAllocatesTilesOnlyWhereReached) {
+    // Peso constante 1: a região alcançada é o losango |dx| + |dy| <= maxCost
+    // ao redor da semente, e só as páginas que ele toca são alocadas
+    const int width = 640, height = 512, tile = SparseIFTResult::TILE_SIZE;
+    Image image(width, height);
+    SeedSet seeds;
+    seeds.addSeed(image.getPixel(200, 300), 1);
+    auto costFunction = createConstantSum(1.0);
+
+    IFTAlgorithm ift;
+    size_t previousTiles = 0;
+    for (double maxCost : {0.0, 10.0, 40.0, 100.0, 300.0}) {
+        auto result = ift.runIFTBounded(image, *costFunction, seeds, maxCost);
+
+        std::set<std::pair<int, int>> touched;
+        size_t diamond = 0;
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (std::abs(x - 200) + std::abs(y - 300) > maxCost) continue;
+                diamond++;
+                touched.insert({x / tile, y / tile});
+            }
+        }
+        EXPECT_EQ(result->getConqueredPixels().size(), diamond) << "maxCost " << maxCost;
+        EXPECT_EQ(result->getAllocatedTileCount(), touched.size()) << "maxCost " << maxCost;
+        EXPECT_GE(result->getAllocatedTileCount(), previousTiles);
+        previousTiles = result->getAllocatedTileCount();
+    }
+    EXPECT_LT(previousTiles, static_cast<size_t>((width / tile) * (height / tile)));
+
+    // Sem sementes dentro do limite nada é alocado
+    SeedSet costly;
+    costly.addSeed(image.getPixel(5, 5), 1, 50.0);
+    auto empty = ift.runIFTBounded(image, *costFunction, costly, 10.0);
+    EXPECT_EQ(empty->getAllocatedTileCount(), 0u);
+    EXPECT_TRUE(empty->getConqueredPixels().empty());
+}
+
+TEST(IFTAlgorithmTest, RegionWithoutHaloMatchesDijkstraInRegion) {
+    // Halo 0: o grafo é só a ROI; sementes fora dela não contam
+    std::mt19937 rng(41);
+    auto costFunction = createIntensityDifferenceSum();
+    for (bool eight : {false, true}) {
+        for (int trial = 0; trial < 5; ++trial) {
+            int width = 20 + rng() % 20, height = 20 + rng() % 20;
+            Image image = randomImage(rng, width, height);
+            SeedSet seeds = randomSeeds(rng, image, 3);
+            int x0 = rng() % (width / 2), y0 = rng() % (height / 2);
+            int w = 1 + rng() % (width - x0), h = 1 + rng() % (height - y0);
+
+            std::vector<double> expected = dijkstra(image, *costFunction, seeds, eight, x0, y0, w, h);
+            std::vector<int> labels = labelsOf(seeds);
+            std::vector<std::vector<double>> perLabel;
+            for (int label : labels) {
+                perLabel.push_back(dijkstra(image, *costFunction, seeds, eight, x0, y0, w, h, label));
+            }
+
+            IFTAlgorithm ift(eight);
+            auto result = ift.runIFTInRegion(image, *costFunction, seeds, x0, y0, w, h);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    size_t v = static_cast<size_t>(y) * width + x;
+                    Pixel pixel = image.getPixel(x, y);
+                    bool inside = x >= x0 && x < x0 + w && y >= y0 && y < y0 + h;
+                    if (!inside) {
+                        EXPECT_FALSE(result->hasLabel(pixel)) << "pixel (" << x << ", " << y << ")";
+                        continue;
+                    }
+                    EXPECT_EQ(result->getCost(pixel), expected[v]) << "pixel (" << x << ", " << y << ")";
+                    int label = uniqueLabel(perLabel, labels, expected, v);
+                    if (label != -1) {
+                        EXPECT_EQ(result->getLabel(pixel), label);
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(IFTAlgorithmTest, RegionWithLargeHaloMatchesWholeImage) {
+    std::mt19937 rng(141);
+    auto costFunction = createIntensityDifferenceSum();
+    for (bool eight : {false, true}) {
+        int width = 30 + rng() % 10, height = 30 + rng() % 10;
+        Image image = randomImage(rng, width, height);
+        SeedSet seeds = randomSeeds(rng, image, 3);
+        std::vector<double> expected = dijkstra(image, *costFunction, seeds, eight, 0, 0, width, height);
+
+        IFTAlgorithm ift(eight);
+        ift.setRegionHalo(width + height);
+        int x0 = width / 3, y0 = height / 4, w = width / 3, h = height / 2;
+        auto result = ift.runIFTInRegion(image, *costFunction, seeds, x0, y0, w, h);
+        for (int y = y0; y < y0 + h; ++y) {
+            for (int x = x0; x < x0 + w; ++x) {
+                EXPECT_EQ(result->getCost(image.getPixel(x, y)), expected[static_cast<size_t>(y) * width + x])
+                    << "pixel (" << x << ", " << y << ")";
+            }
+        }
+    }
+    EXPECT_THROW(IFTAlgorithm().setRegionHalo(-1), std::invalid_argument);
+}
+
+TEST(IFTAlgorithmTest, StitchedQuadrantsReproduceFullRun) {
+    std::mt19937 rng(241);
+    auto costFunction = createIntensityDifferenceSum();
+    const int width = 34, height = 27;
+    Image image = randomImage(rng, width, height);
+    SeedSet seeds = randomSeeds(rng, image, 3);
+
+    IFTAlgorithm ift(true);
+    ift.setRegionHalo(width + height);
+    auto full = ift.runIFTInRegion(image, *costFunction, seeds, 0, 0, width, height);
+
+    IFTResult stitched(width, height);
+    int midX = width / 2, midY = height / 2;
+    stitched.stitchRegion(*ift.runIFTInRegion(image, *costFunction, seeds, 0, 0, midX, midY));
+    stitched.stitchRegion(*ift.runIFTInRegion(image, *costFunction, seeds, midX, 0, width - midX, midY));
+    stitched.stitchRegion(*ift.runIFTInRegion(image, *costFunction, seeds, 0, midY, midX, height - midY));
+    stitched.stitchRegion(*ift.runIFTInRegion(image, *costFunction, seeds, midX, midY, width - midX, height - midY));
+
+    // Cada quadrante viu a imagem inteira: mesma floresta que uma execução só
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            Pixel pixel = image.getPixel(x, y);
+            ASSERT_EQ(stitched.getCost(pixel), full->getCost(pixel)) << "pixel (" << x << ", " << y << ")";
+            EXPECT_EQ(stitched.getLabel(pixel), full->getLabel(pixel));
+            ASSERT_EQ(stitched.hasPredecessor(pixel), full->hasPredecessor(pixel));
+            if (full->hasPredecessor(pixel)) {
+                EXPECT_EQ(stitched.getPredecessor(pixel), full->getPredecessor(pixel));
+            }
+        }
+    }
+    EXPECT_EQ(stitched.getProcessedPixelCount(), full->getProcessedPixelCount());
+    EXPECT_EQ(stitched.getComponentCount(), full->getComponentCount());
+    EXPECT_THROW(stitched.stitchRegion(IFTResult(width + 1, height)), std::invalid_argument);
+}
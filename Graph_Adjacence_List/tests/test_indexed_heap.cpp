@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include "utils/indexed_heap.h"
+#include <functional>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+namespace {
+    // Operações aleatórias comparadas a um std::set de (chave, id): a ordem do set
+    // é a mesma do heap (empate pelo menor id)
+    template <typename Compare>
+    void expectMatchesOrderedSet(unsigned seed, Compare compare) {
+        typedef std::pair<int, int> Entry;
+        auto less = [compare](const Entry& a, const Entry& b) {
+            if (compare(a.first, b.first)) return true;
+            if (compare(b.first, a.first)) return false;
+            return a.second < b.second;
+        };
+        std::set<Entry, decltype(less)> reference(less);
+        std::vector<int> keyOf(200, 0);
+        std::vector<bool> present(200, false);
+
+        std::mt19937 rng(seed);
+        IndexedMinHeap<int, Compare> heap(200, compare);
+        for (int step = 0; step < 20000; ++step) {
+            int id = rng() % 200;
+            int key = static_cast<int>(rng() % 50);     // muitas chaves repetidas
+            switch (rng() % 5) {
+                case 0:
+                case 1:
+                    // push insere ou altera a chave (para cima ou para baixo)
+                    if (present[id]) reference.erase({keyOf[id], id});
+                    heap.push(id, key);
+                    reference.insert({key, id});
+                    keyOf[id] = key;
+                    present[id] = true;
+                    break;
+                case 2:
+                    if (!present[id]) break;
+                    reference.erase({keyOf[id], id});
+                    heap.update(id, key);
+                    reference.insert({key, id});
+                    keyOf[id] = key;
+                    break;
+                case 3:
+                    if (!present[id]) break;
+                    heap.remove(id);
+                    reference.erase({keyOf[id], id});
+                    present[id] = false;
+                    break;
+                default:
+                    if (reference.empty()) break;
+                    ASSERT_EQ(heap.pop(), reference.begin()->second);
+                    present[reference.begin()->second] = false;
+                    reference.erase(reference.begin());
+                    break;
+            }
+
+            ASSERT_EQ(heap.size(), reference.size()) << "step " << step;
+            ASSERT_EQ(heap.contains(id), present[id]);
+            if (present[id]) {
+                ASSERT_EQ(heap.keyOf(id), keyOf[id]);
+            }
+            if (!reference.empty()) {
+                ASSERT_EQ(heap.top(), reference.begin()->second) << "step " << step;
+                ASSERT_EQ(heap.topKey(), reference.begin()->first);
+            }
+        }
+
+        // Esvaziar por pop devolve a ordem completa
+        while (!reference.empty()) {
+            ASSERT_EQ(heap.pop(), reference.begin()->second);
+            reference.erase(reference.begin());
+        }
+        EXPECT_TRUE(heap.empty());
+    }
+}
+
+TEST(IndexedMinHeapTest, MatchesOrderedSetUnderDecreaseKeyAndRemove) {
+    expectMatchesOrderedSet(33, std::less<int>());
+}
+
+TEST(IndexedMinHeapTest, CustomComparatorGivesMaxHeap) {
+    expectMatchesOrderedSet(133, std::greater<int>());
+}
+
+TEST(IndexedMinHeapTest, TiesPopInIdOrder) {
+    IndexedMinHeap<double> heap(6);
+    for (int id : {4, 1, 5, 0, 3}) heap.push(id, 2.0);
+    heap.push(2, 7.0);
+    heap.update(2, 2.0);          // decrease-key até empatar
+    heap.update(0, 9.0);          // increase-key
+
+    std::vector<int> order;
+    while (!heap.empty()) order.push_back(heap.pop());
+    EXPECT_EQ(order, (std::vector<int>{1, 2, 3, 4, 5, 0}));
+}
+
+TEST(IndexedMinHeapTest, ClearAndReset) {
+    IndexedMinHeap<int> heap(4);
+    EXPECT_THROW(heap.top(), std::out_of_range);
+    heap.push(3, 1);
+    heap.push(1, 2);
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(3));
+    heap.push(3, 5);
+    EXPECT_EQ(heap.top(), 3);
+
+    heap.reset(10);
+    EXPECT_EQ(heap.capacity(), 10);
+    EXPECT_TRUE(heap.empty());
+    EXPECT_FALSE(heap.contains(3));
+    heap.push(9, 4);
+    heap.push(7, 4);
+    EXPECT_EQ(heap.pop(), 7);
+    EXPECT_EQ(heap.pop(), 9);
+    EXPECT_THROW(heap.pop(), std::out_of_range);
+}
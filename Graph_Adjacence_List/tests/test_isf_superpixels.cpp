@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+#include "isf_superpixels.h"
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+
+namespace {
+    // Imagem com blocos de intensidade e ruído
+    Image blockImage(int width, int height, unsigned seed) {
+        std::mt19937 rng(seed);
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int base = ((x / 8 + y / 6) % 3) * 80;
+                image.setPixelValue(x, y, static_cast<uint8_t>(base + rng() % 20));
+            }
+        }
+        return image;
+    }
+}
+
+TEST(ISFSuperpixelsTest, DifferentialIterationsMatchFullIFTFromFinalSeeds) {
+    const int width = 40, height = 30;
+    const double alpha = 0.1, beta = 2.0;
+    Image image = blockImage(width, height, 3);
+    auto costFunction = createIntensityDifferenceSum();
+
+    ISFSuperpixels isf(image, *costFunction, false, alpha, beta);
+    const OptimumPathForest& forest = isf.run(12, 6);
+    ASSERT_GT(isf.getMovedSeedsPerIteration().size(), 1u);
+
+    // Dijkstra do zero com os mesmos pesos a partir das sementes finais
+    const int dx[] = {0, -1, 1, 0};
+    const int dy[] = {-1, 0, 0, 1};
+    std::vector<double> cost(width * height, std::numeric_limits<double>::infinity());
+    typedef std::pair<double, int> Entry;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+    for (const Seed& seed : isf.getSeeds().getActiveSeeds()) {
+        int v = seed.pixel.y * width + seed.pixel.x;
+        cost[v] = 0.0;
+        queue.push({0.0, v});
+    }
+    while (!queue.empty()) {
+        Entry top = queue.top();
+        queue.pop();
+        int s = top.second;
+        if (top.first > cost[s]) continue;
+        for (int d = 0; d < 4; ++d) {
+            int x = s % width + dx[d], y = s / width + dy[d];
+            if (x < 0 || y < 0 || x >= width || y >= height) continue;
+            int t = y * width + x;
+            double w = std::abs(double(image.getPixelValue(s % width, s / width)) - image.getPixelValue(x, y));
+            double extended = cost[s] + std::pow(alpha * w, beta) + 1.0;
+            if (extended < cost[t]) {
+                cost[t] = extended;
+                queue.push({extended, t});
+            }
+        }
+    }
+
+    for (int v = 0; v < width * height; ++v) {
+        EXPECT_NEAR(forest.cost[v], cost[v], 1e-9 * (1.0 + cost[v])) << "pixel " << v;
+        ASSERT_GT(forest.label[v], 0);
+        EXPECT_EQ(forest.label[forest.root[v]], forest.label[v]);
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include "Undirected_Graph.h"
+#include "utils/knn_graph.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+
+namespace {
+    // k vizinhos por força bruta: distância ao quadrado em float somada na ordem
+    // das dimensões (como nas folhas), empate pelo menor índice
+    KnnGraphBuilder::Neighbors bruteForce(const std::vector<float>& points, size_t dimensions, int k) {
+        int n = static_cast<int>(points.size() / dimensions);
+        KnnGraphBuilder::Neighbors result;
+        result.k = k;
+        result.index.assign(static_cast<size_t>(n) * k, -1);
+        result.distance.assign(static_cast<size_t>(n) * k, std::numeric_limits<float>::infinity());
+        for (int i = 0; i < n; ++i) {
+            std::vector<std::pair<float, int>> all;
+            for (int j = 0; j < n; ++j) {
+                if (j == i) continue;
+                float sum = 0.0f;
+                for (size_t d = 0; d < dimensions; ++d) {
+                    float diff = points[i * dimensions + d] - points[j * dimensions + d];
+                    sum += diff * diff;
+                }
+                all.emplace_back(sum, j);
+            }
+            std::sort(all.begin(), all.end());
+            for (int j = 0; j < k && j < static_cast<int>(all.size()); ++j) {
+                result.index[static_cast<size_t>(i) * k + j] = all[j].second;
+                result.distance[static_cast<size_t>(i) * k + j] = std::sqrt(all[j].first);
+            }
+        }
+        return result;
+    }
+
+    // Simetrização de referência: par (menor, maior) com a distância do k-NN
+    std::vector<std::tuple<double, int, int>> symmetrized(const KnnGraphBuilder::Neighbors& neighbors, int n) {
+        std::map<std::pair<int, int>, float> pairs;
+        for (int u = 0; u < n; ++u) {
+            for (int j = 0; j < neighbors.k; ++j) {
+                int v = neighbors.index[static_cast<size_t>(u) * neighbors.k + j];
+                if (v < 0) continue;
+                pairs[{std::min(u, v), std::max(u, v)}] = neighbors.distance[static_cast<size_t>(u) * neighbors.k + j];
+            }
+        }
+        std::vector<std::tuple<double, int, int>> edges;
+        for (const auto& entry : pairs) edges.emplace_back(entry.second, entry.first.first, entry.first.second);
+        return edges;
+    }
+
+    void expectMatchesBruteForce(const std::vector<float>& points, size_t dimensions, int k, unsigned threads) {
+        int n = static_cast<int>(points.size() / dimensions);
+        KnnGraphBuilder builder(k, threads);
+        KnnGraphBuilder::Neighbors expected = bruteForce(points, dimensions, k);
+        KnnGraphBuilder::Neighbors actual = builder.findNeighbors(points, dimensions);
+        ASSERT_EQ(actual.index, expected.index) << n << " points, " << dimensions << "D, k = " << k;
+        ASSERT_EQ(actual.distance, expected.distance);
+        EXPECT_EQ(builder.buildEdgeList(points, dimensions), symmetrized(expected, n));
+    }
+
+    std::vector<float> randomPoints(std::mt19937& rng, int n, size_t dimensions) {
+        std::uniform_real_distribution<float> coordinate(-10.0f, 10.0f);
+        std::vector<float> points(static_cast<size_t>(n) * dimensions);
+        for (float& value : points) value = coordinate(rng);
+        return points;
+    }
+}
+
+TEST(KnnGraphTest, LinksNearestPoints) {
+    // Dois grupos na reta: {0, 1, 2} e {10, 11}
+    std::vector<float> points = {0.0f, 10.0f, 1.0f, 11.0f, 2.0f};
+    KnnGraphBuilder builder(1);
+
+    auto neighbors = builder.findNeighbors(points, 1);
+    EXPECT_EQ(neighbors.index[0], 2);
+    EXPECT_EQ(neighbors.index[2], 0);  // empate entre 0 e 4: menor índice
+    EXPECT_FLOAT_EQ(neighbors.distance[1], 1.0f);
+
+    auto edges = builder.buildEdgeList(points, 1);
+    std::vector<std::tuple<double, int, int>> expected = {
+        {1.0, 0, 2}, {1.0, 1, 3}, {1.0, 2, 4}};
+    EXPECT_EQ(edges, expected);
+
+    UndirectedGraph g;
+    builder.buildUndirectedGraph(points, 1, g);
+    EXPECT_EQ(g.getNeighbors("2").size(), 2);
+    EXPECT_TRUE(g.getNeighbors("1") == std::vector<std::string>{"3"});
+
+    EXPECT_THROW(KnnGraphBuilder(0), std::invalid_argument);
+    EXPECT_THROW(builder.findNeighbors(points, 2), std::invalid_argument);
+}
+
+TEST(KnnGraphTest, RandomPointsMatchBruteForce) {
+    std::mt19937 rng(50);
+    for (size_t dimensions : {2u, 3u, 7u, 20u}) {
+        for (int n : {17, 100, 333}) {
+            std::vector<float> points = randomPoints(rng, n, dimensions);
+            for (int k : {1, 4, 10}) expectMatchesBruteForce(points, dimensions, k, 1);
+        }
+    }
+}
+
+TEST(KnnGraphTest, DuplicateCoordinatesMatchBruteForce) {
+    // Poucas posições distintas: muitas distâncias 0 e empates por índice,
+    // inclusive dentro de uma folha e entre folhas
+    std::mt19937 rng(150);
+    for (size_t dimensions : {1u, 3u}) {
+        std::vector<float> points;
+        for (int i = 0; i < 200; ++i) {
+            for (size_t d = 0; d < dimensions; ++d) points.push_back(static_cast<float>(rng() % 4));
+        }
+        for (int k : {1, 5, 30}) expectMatchesBruteForce(points, dimensions, k, 1);
+    }
+}
+
+TEST(KnnGraphTest, FewerPointsThanK) {
+    std::mt19937 rng(250);
+    for (int n : {1, 2, 5, 6}) {
+        std::vector<float> points = randomPoints(rng, n, 3);
+        expectMatchesBruteForce(points, 3, 5, 1);
+
+        // Com N <= k cada ponto tem N - 1 vizinhos e o resto fica em -1 / +∞
+        KnnGraphBuilder::Neighbors neighbors = KnnGraphBuilder(5).findNeighbors(points, 3);
+        for (int i = 0; i < n; ++i) {
+            for (int j = 0; j < 5; ++j) {
+                EXPECT_EQ(neighbors.index[i * 5 + j] >= 0, j < n - 1) << "point " << i << ", slot " << j;
+            }
+        }
+    }
+}
+
+TEST(KnnGraphTest, ThreadedMatchesBruteForce) {
+    // 3000 pontos: construção paralela dos níveis de cima e consultas em vários blocos
+    std::mt19937 rng(350);
+    std::vector<float> points = randomPoints(rng, 3000, 4);
+    for (int i = 0; i < 300; ++i) {
+        std::copy_n(&points[(i * 7) * 4], 4, &points[(i * 7 + 3) * 4]);
+    }
+    expectMatchesBruteForce(points, 4, 6, 1);
+    expectMatchesBruteForce(points, 4, 6, 4);
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+#include "live_wire.h"
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+
+    // Dijkstra completo a partir da âncora com os custos de getLocalCost
+    // (arco = custo local do destino, vezes √2 na diagonal)
+    std::vector<double> dijkstra(LiveWire& wire, int width, int height, bool eight, int anchorX, int anchorY) {
+        std::vector<double> cost(static_cast<size_t>(width) * height, std::numeric_limits<double>::infinity());
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> queue;
+        cost[anchorY * width + anchorX] = 0.0;
+        queue.push({0.0, anchorY * width + anchorX});
+        int k = eight ? 8 : 4;
+        while (!queue.empty()) {
+            auto [c, v] = queue.top();
+            queue.pop();
+            if (c != cost[v]) continue;
+            for (int d = 0; d < k; ++d) {
+                int nx = v % width + DX[d], ny = v / width + DY[d];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                double arc = wire.getLocalCost(nx, ny) * (d >= 4 ? std::sqrt(2.0) : 1.0);
+                int u = ny * width + nx;
+                if (c + arc < cost[u]) {
+                    cost[u] = c + arc;
+                    queue.push({cost[u], u});
+                }
+            }
+        }
+        return cost;
+    }
+
+    // Faixas verticais e horizontais com ruído: bordas em várias direções
+    Image randomImage(std::mt19937& rng, int width, int height) {
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                image.setPixelValue(x, y, static_cast<uint8_t>(((x / 7) % 2) * 90 + ((y / 5) % 2) * 60 + rng() % 30));
+            }
+        }
+        return image;
+    }
+}
+
+TEST(LiveWireTest, PathCostMatchesDijkstraAcrossCursorMoves) {
+    std::mt19937 rng(42);
+    for (bool eight : {false, true}) {
+        const int width = 45, height = 38;
+        Image image = randomImage(rng, width, height);
+        LiveWire wire(image, eight);
+        Pixel anchor = image.getPixel(22, 19);
+        std::vector<double> expected = dijkstra(wire, width, height, eight, anchor.x, anchor.y);
+
+        // Vários movimentos na mesma âncora: a fila aberta é re-chaveada a cada
+        // alvo novo e cursores já fechados saem direto da floresta
+        size_t rekeyed = 0;
+        for (int move = 0; move < 30; ++move) {
+            int x = rng() % width, y = rng() % height;
+            double cost = wire.getPathCost(anchor, image.getPixel(x, y));
+            EXPECT_NEAR(cost, expected[y * width + x], 1e-9) << "cursor (" << x << ", " << y << ")";
+            LiveWire::QueryStats stats = wire.getLastQueryStats();
+            EXPECT_EQ(stats.cachedForest, move > 0);
+            rekeyed += stats.rekeyed;
+        }
+        EXPECT_GT(rekeyed, 1u);
+        EXPECT_EQ(wire.getCachedAnchorCount(), 1u);
+        EXPECT_DOUBLE_EQ(wire.getPathCost(anchor, anchor), 0.0);
+    }
+}
+
+TEST(LiveWireTest, PathRunsFromAnchorToCursor) {
+    std::mt19937 rng(142);
+    for (bool eight : {false, true}) {
+        const int width = 40, height = 31;
+        Image image = randomImage(rng, width, height);
+        LiveWire wire(image, eight);
+        Pixel anchor = image.getPixel(3, 4);
+
+        for (int move = 0; move < 10; ++move) {
+            Pixel cursor = image.getPixel(rng() % width, rng() % height);
+            std::vector<Pixel> path = wire.getPath(anchor, cursor);
+            ASSERT_FALSE(path.empty());
+            EXPECT_EQ(path.front(), anchor);
+            EXPECT_EQ(path.back(), cursor);
+            EXPECT_EQ(wire.getLastQueryStats().pathLength, path.size());
+
+            // Passos entre vizinhos; a soma dos arcos é o custo informado
+            double sum = 0.0;
+            for (size_t i = 1; i < path.size(); ++i) {
+                int dx = std::abs(path[i].x - path[i - 1].x), dy = std::abs(path[i].y - path[i - 1].y);
+                ASSERT_EQ(std::max(dx, dy), 1);
+                if (!eight) {
+                    ASSERT_EQ(dx + dy, 1);
+                }
+                sum += wire.getLocalCost(path[i].x, path[i].y) * (dx + dy == 2 ? std::sqrt(2.0) : 1.0);
+            }
+            EXPECT_NEAR(sum, wire.getLastQueryStats().pathCost, 1e-9);
+            EXPECT_NEAR(sum, wire.getPathCost(anchor, cursor), 1e-9);
+        }
+    }
+}
+
+TEST(LiveWireTest, CacheEvictsLeastRecentlyUsedAnchor) {
+    std::mt19937 rng(242);
+    Image image = randomImage(rng, 30, 30);
+    LiveWire wire(image, true, 2);
+    Pixel a = image.getPixel(1, 1), b = image.getPixel(28, 2), c = image.getPixel(15, 27);
+    Pixel cursor = image.getPixel(14, 14);
+
+    wire.getPathCost(a, cursor);
+    wire.getPathCost(b, cursor);
+    wire.getPathCost(a, cursor);           // a volta a ser a mais recente
+    EXPECT_TRUE(wire.getLastQueryStats().cachedForest);
+    wire.getPathCost(c, cursor);           // expulsa b
+    EXPECT_EQ(wire.getCachedAnchorCount(), 2u);
+
+    wire.getPathCost(a, cursor);
+    EXPECT_TRUE(wire.getLastQueryStats().cachedForest);
+    wire.getPathCost(b, cursor);           // recriada; expulsa c
+    EXPECT_FALSE(wire.getLastQueryStats().cachedForest);
+    wire.getPathCost(c, cursor);
+    EXPECT_FALSE(wire.getLastQueryStats().cachedForest);
+
+    // Reduzir a capacidade descarta as menos recentes (fica só c)
+    wire.setCacheCapacity(1);
+    EXPECT_EQ(wire.getCacheCapacity(), 1u);
+    EXPECT_EQ(wire.getCachedAnchorCount(), 1u);
+    wire.getPathCost(c, cursor);
+    EXPECT_TRUE(wire.getLastQueryStats().cachedForest);
+    wire.getPathCost(b, cursor);
+    EXPECT_FALSE(wire.getLastQueryStats().cachedForest);
+
+    wire.clearCache();
+    EXPECT_EQ(wire.getCachedAnchorCount(), 0u);
+    EXPECT_THROW(wire.setCacheCapacity(0), std::invalid_argument);
+    EXPECT_THROW(LiveWire(image, true, 0), std::invalid_argument);
+}
+
+TEST(LiveWireTest, OutOfBoundsPixelsThrow) {
+    Image image(12, 9);
+    LiveWire wire(image);
+    Pixel inside = image.getPixel(5, 5);
+
+    EXPECT_THROW(wire.getPath(Pixel(-1, 0, 0), inside), std::out_of_range);
+    EXPECT_THROW(wire.getPath(inside, Pixel(12, 3, 0)), std::out_of_range);
+    EXPECT_THROW(wire.getPathCost(Pixel(0, 9, 0), inside), std::out_of_range);
+    EXPECT_THROW(wire.getPathCost(inside, Pixel(3, -2, 0)), std::out_of_range);
+    EXPECT_THROW(wire.getLocalCost(12, 0), std::out_of_range);
+    EXPECT_EQ(wire.getCachedAnchorCount(), 0u);
+
+    // Imagem constante: custo local máximo em todo pixel
+    EXPECT_DOUBLE_EQ(wire.getLocalCost(0, 0), 256.0);
+}
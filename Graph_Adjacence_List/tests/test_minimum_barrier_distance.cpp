@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include "minimum_barrier_distance.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0};
+    const int DY[] = {-1, 0, 0, 1};
+
+    // MBD exata (vizinhança-4) por força bruta: para cada limiar inferior l,
+    // caminhos restritos a pixels >= l, com o menor máximo possível (minimax por
+    // relaxação até estabilizar). MBD(t) = min sobre l de (máximo - l)
+    std::vector<int> exactMBD(const Image& image, const std::vector<Pixel>& seeds) {
+        int width = image.getWidth(), height = image.getHeight();
+        int n = width * height;
+        const int NONE = 1 << 20;
+        std::vector<int> result(n, NONE);
+
+        for (int l = 0; l < 256; ++l) {
+            std::vector<int> upper(n, NONE);
+            for (const Pixel& p : seeds) {
+                int value = image.getPixelValue(p.x, p.y);
+                if (value >= l) upper[p.y * width + p.x] = value;
+            }
+
+            bool changed = true;
+            while (changed) {
+                changed = false;
+                for (int v = 0; v < n; ++v) {
+                    if (upper[v] == NONE) continue;
+                    int x = v % width, y = v / width;
+                    for (int d = 0; d < 4; ++d) {
+                        int nx = x + DX[d], ny = y + DY[d];
+                        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                        int value = image.getPixelValue(nx, ny);
+                        if (value < l) continue;
+                        int u = ny * width + nx;
+                        int extended = std::max(upper[v], value);
+                        if (extended < upper[u]) {
+                            upper[u] = extended;
+                            changed = true;
+                        }
+                    }
+                }
+            }
+
+            for (int v = 0; v < n; ++v) {
+                if (upper[v] != NONE) result[v] = std::min(result[v], upper[v] - l);
+            }
+        }
+        return result;
+    }
+
+    SeedSet toSeedSet(const std::vector<Pixel>& pixels) {
+        SeedSet seeds;
+        for (size_t i = 0; i < pixels.size(); ++i) seeds.addSeed(pixels[i], static_cast<int>(i) + 1);
+        return seeds;
+    }
+}
+
+TEST(MinimumBarrierDistanceTest, NeverBelowExactMBD) {
+    std::mt19937 rng(44);
+    // Larguras múltiplas de 4 e não múltiplas: blocos SIMD e resto escalar
+    for (int width : {1, 3, 4, 7, 8, 13}) {
+        for (int trial = 0; trial < 4; ++trial) {
+            int height = 2 + rng() % 10;
+            Image image(width, height);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) image.setPixelValue(x, y, rng() % 256);
+            }
+
+            std::vector<Pixel> pixels;
+            for (int i = 0, count = 1 + rng() % 3; i < count; ++i) {
+                int x = rng() % width, y = rng() % height;
+                pixels.push_back(Pixel(x, y, image.getPixelValue(x, y)));
+            }
+            std::vector<int> expected = exactMBD(image, pixels);
+
+            for (int passes : {1, 3}) {
+                MinimumBarrierDistance mbd(passes);
+                OptimumPathForest forest = mbd.run(image, toSeedSet(pixels));
+                for (int v = 0; v < width * height; ++v) {
+                    ASSERT_TRUE(forest.isConquered(v)) << width << "x" << height << ", pixel " << v;
+                    EXPECT_GE(forest.cost[v], expected[v]) << width << "x" << height << ", pixel " << v;
+                    EXPECT_LE(forest.cost[v], 255.0);
+                    EXPECT_EQ(forest.label[v], forest.label[forest.root[v]]);
+                }
+                for (const Pixel& p : pixels) EXPECT_EQ(forest.cost[p.y * width + p.x], 0.0);
+            }
+        }
+    }
+}
+
+TEST(MinimumBarrierDistanceTest, VerticalRampsMatchExactMBD) {
+    // Sementes na primeira linha (intensidade 0) e colunas crescentes para baixo:
+    // a MBD exata é a própria intensidade, alcançada pelo caminho vertical
+    const int width = 9, height = 6;
+    Image image(width, height);
+    std::vector<Pixel> pixels;
+    for (int x = 0; x < width; ++x) {
+        for (int y = 0; y < height; ++y) image.setPixelValue(x, y, y * (1 + x % 3) * 10);
+        pixels.push_back(Pixel(x, 0, 0));
+    }
+    std::vector<int> expected = exactMBD(image, pixels);
+
+    MinimumBarrierDistance mbd(1);
+    OptimumPathForest forest = mbd.run(image, toSeedSet(pixels));
+    EXPECT_EQ(mbd.getLastPassCount(), 1);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            EXPECT_EQ(expected[v], image.getPixelValue(x, y));
+            EXPECT_EQ(forest.cost[v], expected[v]) << "pixel (" << x << ", " << y << ")";
+        }
+    }
+}
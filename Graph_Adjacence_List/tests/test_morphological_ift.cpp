@@ -0,0 +1,156 @@
+#include <gtest/gtest.h>
+#include "morphological_ift.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+
+    // Dilatação (ou erosão) geodésica elementar repetida até estabilizar
+    template <typename T>
+    std::vector<T> iterativeReconstruction(int width, int height, bool eightConnected, std::vector<T> marker,
+                                           const std::vector<T>& mask, bool byDilation) {
+        int k = eightConnected ? 8 : 4;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            std::vector<T> next = marker;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int v = y * width + x;
+                    T value = marker[v];
+                    for (int d = 0; d < k; ++d) {
+                        int nx = x + DX[d], ny = y + DY[d];
+                        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                        T neighbour = marker[ny * width + nx];
+                        value = byDilation ? std::max(value, neighbour) : std::min(value, neighbour);
+                    }
+                    next[v] = byDilation ? std::min(value, mask[v]) : std::max(value, mask[v]);
+                    if (next[v] != marker[v]) changed = true;
+                }
+            }
+            marker.swap(next);
+        }
+        return marker;
+    }
+
+    // Platôs (componentes de mesma intensidade) sem vizinho mais baixo
+    // (minima) ou mais alto (!minima). Rótulo = índice do componente + 1
+    template <typename T>
+    std::vector<int> bruteForceExtrema(int width, int height, bool eightConnected, const std::vector<T>& image,
+                                       bool minima) {
+        int n = width * height, k = eightConnected ? 8 : 4;
+        std::vector<int> component(n, -1), labels(n, 0);
+        int count = 0;
+        for (int start = 0; start < n; ++start) {
+            if (component[start] != -1) continue;
+            std::vector<int> stack = {start}, members;
+            component[start] = start;
+            bool extremum = true;
+            while (!stack.empty()) {
+                int v = stack.back();
+                stack.pop_back();
+                members.push_back(v);
+                int x = v % width, y = v / width;
+                for (int d = 0; d < k; ++d) {
+                    int nx = x + DX[d], ny = y + DY[d];
+                    if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                    int u = ny * width + nx;
+                    if (image[u] == image[v]) {
+                        if (component[u] == -1) {
+                            component[u] = start;
+                            stack.push_back(u);
+                        }
+                    } else if (minima ? image[u] < image[v] : image[u] > image[v]) {
+                        extremum = false;
+                    }
+                }
+            }
+            if (extremum) {
+                count++;
+                for (int v : members) labels[v] = count;
+            }
+        }
+        return labels;
+    }
+
+    // Mesma partição, a menos de renumeração dos rótulos
+    void expectSamePartition(const std::vector<int>& actual, const std::vector<int>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        std::vector<int> map(actual.size() + 1, -1);
+        for (size_t v = 0; v < actual.size(); ++v) {
+            ASSERT_EQ(actual[v] == 0, expected[v] == 0) << "pixel " << v;
+            if (expected[v] == 0) continue;
+            if (map[expected[v]] == -1) map[expected[v]] = actual[v];
+            EXPECT_EQ(map[expected[v]], actual[v]) << "pixel " << v;
+        }
+    }
+
+    template <typename T>
+    void checkRandom(std::mt19937& rng, int levels, int scale) {
+        for (bool eight : {false, true}) {
+            for (int trial = 0; trial < 6; ++trial) {
+                int width = 2 + rng() % 14, height = 2 + rng() % 14;
+                int n = width * height;
+                MorphologicalIFT<T> ift(width, height, eight);
+
+                std::vector<T> mask(n), marker(n), markerAbove(n), image(n);
+                for (int v = 0; v < n; ++v) {
+                    mask[v] = static_cast<T>((rng() % levels) * scale);
+                    marker[v] = rng() % 4 == 0 ? static_cast<T>(mask[v] - (rng() % levels) * scale / 2) : 0;
+                    marker[v] = std::min(marker[v], mask[v]);
+                    markerAbove[v] = rng() % 4 == 0 ? mask[v] : static_cast<T>((levels - 1) * scale);
+                    image[v] = static_cast<T>((rng() % 3) * scale);
+                }
+
+                EXPECT_EQ(ift.reconstructByDilation(marker, mask),
+                          iterativeReconstruction<T>(width, height, eight, marker, mask, true));
+                EXPECT_EQ(ift.reconstructByErosion(markerAbove, mask),
+                          iterativeReconstruction<T>(width, height, eight, markerAbove, mask, false));
+
+                std::vector<int> labels;
+                std::vector<int> expected = bruteForceExtrema<T>(width, height, eight, image, true);
+                EXPECT_EQ(ift.regionalMinima(image, labels), *std::max_element(expected.begin(), expected.end()));
+                expectSamePartition(labels, expected);
+
+                expected = bruteForceExtrema<T>(width, height, eight, image, false);
+                EXPECT_EQ(ift.regionalMaxima(image, labels), *std::max_element(expected.begin(), expected.end()));
+                expectSamePartition(labels, expected);
+            }
+        }
+    }
+}
+
+TEST(MorphologicalIFTTest, MatchesIterativeGeodesicReconstruction8Bit) {
+    std::mt19937 rng(45);
+    checkRandom<uint8_t>(rng, 6, 40);
+}
+
+TEST(MorphologicalIFTTest, MatchesIterativeGeodesicReconstruction16Bit) {
+    std::mt19937 rng(145);
+    checkRandom<uint16_t>(rng, 6, 10000);
+}
+
+TEST(MorphologicalIFTTest, RegionalMinimaSeedsCarryMinimumIntensity) {
+    std::mt19937 rng(245);
+    Image image(11, 9);
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 11; ++x) image.setPixelValue(x, y, (rng() % 4) * 50);
+    }
+
+    std::vector<uint8_t> values;
+    for (int y = 0; y < 9; ++y) {
+        for (int x = 0; x < 11; ++x) values.push_back(image.getPixelValue(x, y));
+    }
+    std::vector<int> expected = bruteForceExtrema<uint8_t>(11, 9, true, values, true);
+
+    SeedSet seeds = regionalMinimaSeeds(image);
+    std::vector<int> labels(values.size(), 0);
+    for (const Seed& seed : seeds.getActiveSeeds()) {
+        EXPECT_EQ(seed.handicap, seed.pixel.intensity);
+        EXPECT_EQ(seed.pixel.intensity, image.getPixelValue(seed.pixel.x, seed.pixel.y));
+        labels[seed.pixel.y * 11 + seed.pixel.x] = seed.label;
+    }
+    expectSamePartition(labels, expected);
+}
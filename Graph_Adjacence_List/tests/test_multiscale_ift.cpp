@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include "multiscale_ift.h"
+#include "ift_optimized_algorithm.h"
+#include <random>
+
+namespace {
+    // Disco escuro sobre fundo claro, com ruído
+    Image discImage(int width, int height, unsigned seed) {
+        std::mt19937 rng(seed);
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int dx = x - width / 2, dy = y - height / 2;
+                int base = dx * dx + dy * dy < (width / 4) * (width / 4) ? 40 : 200;
+                image.setPixelValue(x, y, static_cast<uint8_t>(base + rng() % 12));
+            }
+        }
+        return image;
+    }
+
+    SeedSet discSeeds(const Image& image) {
+        SeedSet seeds;
+        int cx = image.getWidth() / 2, cy = image.getHeight() / 2;
+        seeds.addSeed(image.getPixel(cx, cy), 1);
+        seeds.addSeed(image.getPixel(3, 3), 2);
+        seeds.addSeed(image.getPixel(image.getWidth() - 4, image.getHeight() - 4), 2);
+        return seeds;
+    }
+}
+
+TEST(MultiscaleIFTTest, SingleLevelMatchesOptimizedIFT) {
+    Image image = discImage(48, 40, 1);
+    SeedSet seeds = discSeeds(image);
+    auto costFunction = createIntensityDifferenceSum();
+
+    MultiscaleIFT multiscale(1);
+    auto result = multiscale.run(image, *costFunction, seeds);
+
+    OptimizedIFTAlgorithm reference;
+    auto expected = reference.runOptimizedIFT(image, *costFunction, seeds);
+
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            EXPECT_DOUBLE_EQ(result.costs[y * image.getWidth() + x], expected->getCost(image.getPixel(x, y)));
+        }
+    }
+}
+
+TEST(MultiscaleIFTTest, PyramidLabelsMatchOptimizedIFT) {
+    Image image = discImage(128, 128, 2);
+    SeedSet seeds = discSeeds(image);
+    auto costFunction = createIntensityDifferenceSum();
+
+    MultiscaleIFT multiscale(3, 2, false, 16);
+    auto result = multiscale.run(image, *costFunction, seeds);
+    ASSERT_EQ(result.levels.size(), 3u);
+
+    OptimizedIFTAlgorithm reference;
+    auto expected = reference.runOptimizedIFT(image, *costFunction, seeds);
+
+    int mismatches = 0;
+    for (int y = 0; y < image.getHeight(); ++y) {
+        for (int x = 0; x < image.getWidth(); ++x) {
+            if (result.labels[y * image.getWidth() + x] != expected->getLabel(image.getPixel(x, y))) mismatches++;
+        }
+    }
+    EXPECT_LE(mismatches, image.getWidth() * image.getHeight() / 100);
+
+    // Só a faixa é reprocessada nos níveis finos
+    EXPECT_LT(result.levels.back().processedPixels, size_t(image.getWidth() * image.getHeight() / 2));
+}
+
+TEST(MultiscaleIFTTest, SeedCollidingAtCoarseLevelStillPropagates) {
+    Image image(64, 64, 100);
+    SeedSet seeds;
+    seeds.addSeed(image.getPixel(20, 20), 1);
+    seeds.addSeed(image.getPixel(21, 20), 2);   // mesmo pixel que (20, 20) nos níveis grossos
+    seeds.addSeed(image.getPixel(21, 21), 1);
+    seeds.addSeed(image.getPixel(50, 50), 3);
+    auto costFunction = createConstantSum(1.0);
+
+    MultiscaleIFT multiscale(3, 2, false, 8);
+    auto result = multiscale.run(image, *costFunction, seeds);
+
+    EXPECT_EQ(result.labels[20 * 64 + 21], 2);
+    EXPECT_EQ(result.labels[20 * 64 + 22], 2);
+    EXPECT_EQ(result.labels[20 * 64 + 19], 1);
+    EXPECT_DOUBLE_EQ(result.costs[20 * 64 + 22], 1.0);
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "opf_classifier.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+
+    double distance(const float* a, const float* b, size_t dimensions) {
+        double sum = 0.0;
+        for (size_t d = 0; d < dimensions; ++d) sum += (double(a[d]) - b[d]) * (double(a[d]) - b[d]);
+        return std::sqrt(sum);
+    }
+
+    // OPF de referência em O(n^2): Prim para os protótipos, IFT f_max densa a
+    // partir deles (custo e rótulo por amostra)
+    struct Reference {
+        std::vector<int> prototypes;
+        std::vector<double> cost;
+        std::vector<int> label;
+    };
+
+    Reference train(const std::vector<float>& features, size_t dimensions, const std::vector<int>& labels) {
+        int n = static_cast<int>(labels.size());
+        auto dist = [&](int a, int b) { return distance(&features[a * dimensions], &features[b * dimensions], dimensions); };
+
+        Reference ref;
+        std::vector<double> key(n, INF);
+        std::vector<int> parent(n, -1);
+        std::vector<char> done(n, 0), prototype(n, 0);
+        key[0] = 0.0;
+        for (int step = 0; step < n; ++step) {
+            int v = -1;
+            for (int u = 0; u < n; ++u) {
+                if (!done[u] && (v == -1 || key[u] < key[v])) v = u;
+            }
+            done[v] = 1;
+            if (parent[v] != -1 && labels[parent[v]] != labels[v]) prototype[v] = prototype[parent[v]] = 1;
+            for (int u = 0; u < n; ++u) {
+                if (!done[u] && dist(v, u) < key[u]) {
+                    key[u] = dist(v, u);
+                    parent[u] = v;
+                }
+            }
+        }
+        for (int v = 0; v < n; ++v) {
+            if (prototype[v]) ref.prototypes.push_back(v);
+        }
+        // Um único rótulo: nenhuma aresta da MST liga rótulos distintos
+        if (ref.prototypes.empty()) ref.prototypes.push_back(0);
+
+        ref.cost.assign(n, INF);
+        ref.label.assign(n, -1);
+        for (int p : ref.prototypes) {
+            ref.cost[p] = 0.0;
+            ref.label[p] = labels[p];
+        }
+        std::fill(done.begin(), done.end(), 0);
+        for (int step = 0; step < n; ++step) {
+            int v = -1;
+            for (int u = 0; u < n; ++u) {
+                if (!done[u] && (v == -1 || ref.cost[u] < ref.cost[v])) v = u;
+            }
+            if (ref.cost[v] == INF) break;
+            done[v] = 1;
+            for (int u = 0; u < n; ++u) {
+                double extended = std::max(ref.cost[v], dist(v, u));
+                if (!done[u] && extended < ref.cost[u]) {
+                    ref.cost[u] = extended;
+                    ref.label[u] = ref.label[v];
+                }
+            }
+        }
+        return ref;
+    }
+
+    // Amostras em três grupos sobrepostos
+    void randomSamples(std::mt19937& rng, int n, size_t dimensions, std::vector<float>& features,
+                       std::vector<int>& labels) {
+        std::normal_distribution<float> noise(0.0f, 1.0f);
+        features.clear();
+        labels.clear();
+        for (int i = 0; i < n; ++i) {
+            int label = static_cast<int>(rng() % 3);
+            for (size_t d = 0; d < dimensions; ++d) features.push_back(1.5f * label * ((d % 2) ? 1 : -1) + noise(rng));
+            labels.push_back(label + 1);
+        }
+    }
+}
+
+TEST(OPFClassifierTest, MatchesBruteForceOPF) {
+    std::mt19937 rng(49);
+    for (size_t dimensions : {1u, 3u, 8u, 13u}) {
+        for (int n : {1, 7, 29, 64}) {
+            std::vector<float> features, queries;
+            std::vector<int> labels, ignored;
+            randomSamples(rng, n, dimensions, features, labels);
+            randomSamples(rng, 40, dimensions, queries, ignored);
+
+            OPFClassifier opf(2);
+            opf.train(features, dimensions, labels);
+            Reference ref = train(features, dimensions, labels);
+
+            ASSERT_EQ(opf.getPrototypes(), ref.prototypes) << n << " samples, " << dimensions << "D";
+            const OptimumPathForest& forest = opf.getTrainingForest();
+            for (int v = 0; v < n; ++v) {
+                if (ref.cost[v] == INF) continue;
+                EXPECT_NEAR(forest.cost[v], ref.cost[v], 1e-4) << "sample " << v;
+                EXPECT_EQ(forest.label[v], ref.label[v]) << "sample " << v;
+            }
+
+            // Classificação: min sobre t de max(C(t), d(s, t)), rótulo do argmin
+            std::vector<int> predicted = opf.classify(queries);
+            for (size_t q = 0; q < predicted.size(); ++q) {
+                const float* sample = &queries[q * dimensions];
+                // Melhor custo por rótulo; só empates entre rótulos distintos importam
+                std::vector<double> best(4, INF);
+                for (int t = 0; t < n; ++t) {
+                    if (ref.cost[t] == INF) continue;
+                    double c = std::max(ref.cost[t], distance(sample, &features[t * dimensions], dimensions));
+                    best[ref.label[t]] = std::min(best[ref.label[t]], c);
+                }
+                int label = static_cast<int>(std::min_element(best.begin(), best.end()) - best.begin());
+                bool tie = false;
+                for (int other = 1; other < 4; ++other) {
+                    if (other != label && best[other] - best[label] < 1e-4) tie = true;
+                }
+                if (tie) continue;
+                EXPECT_EQ(predicted[q], label) << "query " << q;
+                EXPECT_EQ(opf.classify(sample), label) << "query " << q;
+            }
+        }
+    }
+}
+
+TEST(OPFClassifierTest, ThreadedTrainingMatchesSingleThread) {
+    // 9000 amostras: dois blocos de 4096+ por passo de Prim e da IFT
+    std::mt19937 rng(149);
+    const size_t dimensions = 3;
+    std::vector<float> features, queries;
+    std::vector<int> labels, ignored;
+    randomSamples(rng, 9000, dimensions, features, labels);
+    randomSamples(rng, 200, dimensions, queries, ignored);
+
+    OPFClassifier single(1), threaded(4);
+    single.train(features, dimensions, labels);
+    threaded.train(features, dimensions, labels);
+
+    EXPECT_EQ(threaded.getPrototypes(), single.getPrototypes());
+    EXPECT_EQ(threaded.getTrainingForest().cost, single.getTrainingForest().cost);
+    EXPECT_EQ(threaded.getTrainingForest().label, single.getTrainingForest().label);
+    EXPECT_EQ(threaded.classify(queries), single.classify(queries));
+}
+
+TEST(OPFClassifierTest, SingleSampleClassifyUpdatesStats) {
+    std::mt19937 rng(249);
+    std::vector<float> features, queries;
+    std::vector<int> labels, ignored;
+    randomSamples(rng, 50, 2, features, labels);
+    randomSamples(rng, 10, 2, queries, ignored);
+
+    OPFClassifier opf(1);
+    opf.train(features, 2, labels);
+    opf.classify(queries);
+    EXPECT_EQ(opf.getLastClassifyStats().samples, 10u);
+
+    opf.classify(&queries[0]);
+    OPFClassifier::ClassifyStats stats = opf.getLastClassifyStats();
+    EXPECT_EQ(stats.samples, 1u);
+    EXPECT_GE(stats.averageVisited, 1.0);
+    EXPECT_LE(stats.averageVisited, 50.0);
+    EXPECT_GE(stats.executionTimeMs, 0.0);
+}
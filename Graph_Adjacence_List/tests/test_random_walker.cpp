@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "random_walker.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <set>
+
+namespace {
+    // Probabilidades [v * K + k] por solução direta densa de L_U X = -B M
+    // (eliminação gaussiana), com as mesmas condutâncias float do RandomWalker
+    std::vector<double> denseSolve(const Image& image, const SeedSet& seeds, double beta,
+                                   std::vector<int>& labelValues) {
+        int width = image.getWidth(), height = image.getHeight(), n = width * height;
+
+        std::set<int> distinct;
+        for (const Seed& seed : seeds.getActiveSeeds()) distinct.insert(seed.label);
+        labelValues.assign(distinct.begin(), distinct.end());
+        int labelCount = static_cast<int>(labelValues.size());
+
+        std::vector<int> seedColumn(n, -1);
+        for (const Seed& seed : seeds.getActiveSeeds()) {
+            seedColumn[seed.pixel.y * width + seed.pixel.x] = static_cast<int>(
+                std::lower_bound(labelValues.begin(), labelValues.end(), seed.label) - labelValues.begin());
+        }
+
+        auto conductance = [&](int a, int b) {
+            double d = std::abs(a - b) / 255.0;
+            return static_cast<double>(static_cast<float>(std::exp(-beta * d * d) + 1e-6));
+        };
+
+        std::vector<int> unknown(n, -1);
+        int m = 0;
+        for (int v = 0; v < n; ++v) {
+            if (seedColumn[v] < 0) unknown[v] = m++;
+        }
+
+        // Matriz aumentada [L_U | -B M]
+        std::vector<std::vector<double>> a(m, std::vector<double>(m + labelCount, 0.0));
+        const int DX[] = {0, -1, 1, 0};
+        const int DY[] = {-1, 0, 0, 1};
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int v = y * width + x;
+                if (unknown[v] < 0) continue;
+                for (int d = 0; d < 4; ++d) {
+                    int nx = x + DX[d], ny = y + DY[d];
+                    if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                    int u = ny * width + nx;
+                    double w = conductance(image.getPixelValue(x, y), image.getPixelValue(nx, ny));
+                    a[unknown[v]][unknown[v]] += w;
+                    if (unknown[u] >= 0) a[unknown[v]][unknown[u]] -= w;
+                    else a[unknown[v]][m + seedColumn[u]] += w;
+                }
+            }
+        }
+
+        for (int col = 0; col < m; ++col) {
+            int pivot = col;
+            for (int r = col + 1; r < m; ++r) {
+                if (std::abs(a[r][col]) > std::abs(a[pivot][col])) pivot = r;
+            }
+            std::swap(a[col], a[pivot]);
+            for (int r = 0; r < m; ++r) {
+                if (r == col || a[r][col] == 0.0) continue;
+                double factor = a[r][col] / a[col][col];
+                for (int c = col; c < m + labelCount; ++c) a[r][c] -= factor * a[col][c];
+            }
+        }
+
+        std::vector<double> probabilities(static_cast<size_t>(n) * labelCount, 0.0);
+        for (int v = 0; v < n; ++v) {
+            for (int k = 0; k < labelCount; ++k) {
+                probabilities[static_cast<size_t>(v) * labelCount + k] =
+                    unknown[v] < 0 ? (seedColumn[v] == k ? 1.0 : 0.0) : a[unknown[v]][m + k] / a[unknown[v]][unknown[v]];
+            }
+        }
+        return probabilities;
+    }
+}
+
+TEST(RandomWalkerTest, MatchesDenseDirectSolve) {
+    std::mt19937 rng(48);
+    for (int labelCount : {1, 2, 3, 4}) {
+        for (double beta : {10.0, 90.0}) {
+            int width = 5 + rng() % 8, height = 5 + rng() % 8;
+            Image image(width, height);
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) image.setPixelValue(x, y, (x < width / 2 ? 50 : 180) + rng() % 40);
+            }
+
+            SeedSet seeds;
+            for (int label = 1; label <= labelCount; ++label) {
+                for (int i = 0; i < 2; ++i) {
+                    Pixel p = image.getPixel(rng() % width, rng() % height);
+                    if (!seeds.isSeed(p)) seeds.addSeed(p, label * 10);
+                }
+            }
+
+            std::vector<int> labelValues;
+            std::vector<double> expected = denseSolve(image, seeds, beta, labelValues);
+            int k = static_cast<int>(labelValues.size());
+
+            RandomWalker walker(beta, 5000, 1e-10);
+            RandomWalker::Result result = walker.run(image, seeds);
+            ASSERT_EQ(result.labelValues, labelValues);
+            EXPECT_LE(result.relativeResidual, 1e-10);
+
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    const double* p = &expected[(static_cast<size_t>(y) * width + x) * k];
+                    for (int c = 0; c < k; ++c) {
+                        EXPECT_NEAR(result.getProbability(x, y, c), p[c], 1e-4)
+                            << "pixel (" << x << ", " << y << "), label " << labelValues[c];
+                    }
+
+                    // Rótulo mais provável, quando não há empate numérico
+                    std::vector<double> sorted(p, p + k);
+                    std::sort(sorted.rbegin(), sorted.rend());
+                    if (k == 1 || sorted[0] - sorted[1] > 1e-3) {
+                        int best = static_cast<int>(std::max_element(p, p + k) - p);
+                        EXPECT_EQ(result.labels[y * width + x], labelValues[best]);
+                    }
+                }
+            }
+
+            // Somas parciais combinadas em ordem: o número de threads não muda nada
+            walker.setThreads(3);
+            RandomWalker::Result threaded = walker.run(image, seeds);
+            EXPECT_EQ(threaded.probabilities, result.probabilities);
+            EXPECT_EQ(threaded.iterations, result.iterations);
+        }
+    }
+}
+
+TEST(RandomWalkerTest, ThreadedSolveMatchesSingleThread) {
+    // 64 linhas: 4 blocos de 16 linhas na equipe de threads do CG
+    std::mt19937 rng(148);
+    const int width = 48, height = 64;
+    Image image(width, height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) image.setPixelValue(x, y, (x + y < 56 ? 40 : 200) + rng() % 30);
+    }
+    SeedSet seeds;
+    seeds.addSeed(image.getPixel(3, 4), 1);
+    seeds.addSeed(image.getPixel(44, 60), 2);
+    seeds.addSeed(image.getPixel(40, 5), 3);
+
+    RandomWalker walker(90.0, 5000, 1e-8);
+    walker.setThreads(1);
+    RandomWalker::Result single = walker.run(image, seeds);
+    walker.setThreads(4);
+    RandomWalker::Result threaded = walker.run(image, seeds);
+
+    EXPECT_LE(single.relativeResidual, 1e-8);
+    EXPECT_EQ(threaded.iterations, single.iterations);
+    EXPECT_EQ(threaded.probabilities, single.probabilities);
+    EXPECT_EQ(threaded.labels, single.labels);
+}
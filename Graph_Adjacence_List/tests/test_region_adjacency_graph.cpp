@@ -0,0 +1,280 @@
+#include <gtest/gtest.h>
+#include "utils/region_adjacency_graph.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    typedef std::vector<std::vector<uint8_t>> GrayImage;
+    typedef std::vector<std::vector<std::array<uint8_t, 3>>> RGBImage;
+
+    // Rótulos de Voronoi (regiões irregulares, algumas com pedaços isolados por
+    // ruído) renumerados ao acaso para não seguirem a ordem de varredura
+    std::vector<int> randomLabels(std::mt19937& rng, int width, int height, int regions) {
+        std::vector<std::pair<int, int>> centers(regions);
+        for (auto& c : centers) c = {int(rng() % width), int(rng() % height)};
+        std::vector<int> permutation(regions);
+        std::iota(permutation.begin(), permutation.end(), 0);
+        std::shuffle(permutation.begin(), permutation.end(), rng);
+
+        std::vector<int> labels(static_cast<size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int best = 0;
+                long long bestDistance = -1;
+                for (int r = 0; r < regions; ++r) {
+                    long long dx = x - centers[r].first, dy = y - centers[r].second;
+                    if (bestDistance < 0 || dx * dx + dy * dy < bestDistance) {
+                        bestDistance = dx * dx + dy * dy;
+                        best = r;
+                    }
+                }
+                if (rng() % 50 == 0) best = rng() % regions;
+                labels[y * width + x] = permutation[best];
+            }
+        }
+        return labels;
+    }
+
+    // Cor por região com ruído por pixel
+    RGBImage randomImage(std::mt19937& rng, const std::vector<int>& labels, int width, int height, int regions) {
+        std::vector<std::array<uint8_t, 3>> base(regions);
+        for (auto& color : base) color = {uint8_t(rng() % 200), uint8_t(rng() % 200), uint8_t(rng() % 200)};
+        RGBImage image(height, std::vector<std::array<uint8_t, 3>>(width));
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                const std::array<uint8_t, 3>& color = base[labels[y * width + x]];
+                for (int ch = 0; ch < 3; ++ch) image[y][x][ch] = uint8_t(color[ch] + rng() % 40);
+            }
+        }
+        return image;
+    }
+
+    GrayImage grayOf(const RGBImage& image) {
+        GrayImage gray(image.size());
+        for (size_t y = 0; y < image.size(); ++y) {
+            for (const auto& pixel : image[y]) gray[y].push_back(pixel[0]);
+        }
+        return gray;
+    }
+
+    // Varredura direta de todos os pares 4-adjacentes
+    template <typename Difference>
+    std::map<std::pair<int, int>, RegionEdge> bruteForceEdges(const std::vector<int>& labels, int width, int height,
+                                                              Difference difference) {
+        std::map<std::pair<int, int>, RegionEdge> edges;
+        auto visit = [&](int x1, int y1, int x2, int y2) {
+            int a = labels[y1 * width + x1], b = labels[y2 * width + x2];
+            if (a == b) return;
+            RegionEdge& edge = edges[{std::min(a, b), std::max(a, b)}];
+            edge.a = std::min(a, b);
+            edge.b = std::max(a, b);
+            edge.boundaryLength++;
+            edge.contrastSum += difference(x1, y1, x2, y2);
+        };
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                if (x + 1 < width) visit(x, y, x + 1, y);
+                if (y + 1 < height) visit(x, y, x, y + 1);
+            }
+        }
+        return edges;
+    }
+
+    double channel(const std::array<uint8_t, 3>& pixel, int ch) { return pixel[ch]; }
+    double channel(uint8_t pixel, int) { return pixel; }
+
+    template <typename Image, typename Difference>
+    void expectMatchesBruteForce(const RegionAdjacencyGraph& rag, const Image& image, const std::vector<int>& labels,
+                                 int width, int height, int regions, Difference difference) {
+        ASSERT_EQ(rag.getRegionCount(), regions);
+
+        std::vector<int> area(regions, 0);
+        std::vector<std::array<double, 3>> colorSum(regions, {0.0, 0.0, 0.0});
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int r = labels[y * width + x];
+                area[r]++;
+                for (int ch = 0; ch < 3; ++ch) colorSum[r][ch] += channel(image[y][x], ch);
+            }
+        }
+        for (int r = 0; r < regions; ++r) {
+            EXPECT_EQ(rag.getArea(r), area[r]);
+            std::array<double, 3> mean = rag.getMeanColor(r);
+            for (int ch = 0; ch < 3; ++ch) {
+                EXPECT_NEAR(mean[ch], area[r] > 0 ? colorSum[r][ch] / area[r] : 0.0, 1e-9);
+            }
+        }
+
+        std::map<std::pair<int, int>, RegionEdge> expected = bruteForceEdges(labels, width, height, difference);
+        const std::vector<RegionEdge>& edges = rag.getEdges();
+        ASSERT_EQ(edges.size(), expected.size());
+        size_t i = 0;
+        for (const auto& entry : expected) {
+            const RegionEdge& edge = edges[i++];
+            EXPECT_EQ(edge.a, entry.second.a);
+            EXPECT_EQ(edge.b, entry.second.b);
+            EXPECT_EQ(edge.boundaryLength, entry.second.boundaryLength);
+            EXPECT_NEAR(edge.contrastSum, entry.second.contrastSum, 1e-9);
+        }
+
+        // CSR: dois arcos por aresta, peso = contraste, arcEdge aponta para a aresta certa
+        const CSRGraph& csr = rag.getCSR();
+        ASSERT_EQ(csr.getVertexCount(), regions);
+        EXPECT_EQ(csr.getArcCount(), 2 * edges.size());
+        for (int v = 0; v < regions; ++v) {
+            for (auto arc = csr.arcBegin(v); arc < csr.arcEnd(v); ++arc) {
+                const RegionEdge& edge = edges[csr.arcEdge(arc)];
+                int u = csr.arcTarget(arc);
+                EXPECT_EQ(std::min(u, v), edge.a);
+                EXPECT_EQ(std::max(u, v), edge.b);
+                EXPECT_DOUBLE_EQ(csr.arcWeight(arc), edge.contrast());
+            }
+        }
+    }
+
+    // Simulação direta das regras de mergeRegions: menor (contraste, id) primeiro;
+    // o grupo com mais fronteiras vivas absorve o outro (empate: extremo a); fronteiras
+    // paralelas somam na aresta já existente do grupo que fica
+    std::vector<int> naiveMerge(const RegionAdjacencyGraph& rag, int target, double maxContrast) {
+        int regions = rag.getRegionCount();
+        std::vector<RegionEdge> work = rag.getEdges();
+        std::vector<bool> alive(work.size(), true);
+        std::vector<int> group(regions);
+        std::iota(group.begin(), group.end(), 0);
+
+        auto degree = [&](int g) {
+            int d = 0;
+            for (size_t e = 0; e < work.size(); ++e) d += alive[e] && (work[e].a == g || work[e].b == g);
+            return d;
+        };
+        auto findEdge = [&](int g, int h) {
+            for (size_t e = 0; e < work.size(); ++e) {
+                if (alive[e] && ((work[e].a == g && work[e].b == h) || (work[e].a == h && work[e].b == g))) return int(e);
+            }
+            return -1;
+        };
+
+        int remaining = regions;
+        while (remaining > target) {
+            int chosen = -1;
+            for (size_t e = 0; e < work.size(); ++e) {
+                if (alive[e] && (chosen < 0 || work[e].contrast() < work[chosen].contrast())) chosen = int(e);
+            }
+            if (chosen < 0 || work[chosen].contrast() > maxContrast) break;
+
+            int keep = work[chosen].a, drop = work[chosen].b;
+            if (degree(keep) < degree(drop)) std::swap(keep, drop);
+            alive[chosen] = false;
+
+            for (size_t e = 0; e < work.size(); ++e) {
+                if (!alive[e] || (work[e].a != drop && work[e].b != drop)) continue;
+                int neighbor = work[e].a == drop ? work[e].b : work[e].a;
+                int existing = findEdge(keep, neighbor);
+                if (existing >= 0) {
+                    work[existing].boundaryLength += work[e].boundaryLength;
+                    work[existing].contrastSum += work[e].contrastSum;
+                    alive[e] = false;
+                } else if (work[e].a == drop) {
+                    work[e].a = keep;
+                } else {
+                    work[e].b = keep;
+                }
+            }
+            for (int& g : group) {
+                if (g == drop) g = keep;
+            }
+            remaining--;
+        }
+
+        std::vector<int> regionMap(regions);
+        std::map<int, int> groupLabel;
+        for (int r = 0; r < regions; ++r) {
+            auto inserted = groupLabel.insert({group[r], int(groupLabel.size())});
+            regionMap[r] = inserted.first->second;
+        }
+        return regionMap;
+    }
+}
+
+TEST(RegionAdjacencyGraphTest, GrayGraphMatchesBruteForce) {
+    // Mais de 64 linhas: vários blocos e fronteiras que cruzam a divisa entre eles
+    std::mt19937 rng(33);
+    const int width = 90, height = 300, regions = 40;
+    std::vector<int> labels = randomLabels(rng, width, height, regions);
+    GrayImage image = grayOf(randomImage(rng, labels, width, height, regions));
+    auto difference = [&](int x1, int y1, int x2, int y2) {
+        return std::abs(double(image[y1][x1]) - double(image[y2][x2]));
+    };
+
+    for (unsigned threads : {1u, 4u}) {
+        RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(image, labels, threads);
+        expectMatchesBruteForce(rag, image, labels, width, height, regions, difference);
+    }
+}
+
+TEST(RegionAdjacencyGraphTest, RGBGraphMatchesBruteForce) {
+    std::mt19937 rng(133);
+    const int width = 70, height = 260, regions = 55;
+    std::vector<int> labels = randomLabels(rng, width, height, regions);
+    RGBImage image = randomImage(rng, labels, width, height, regions);
+    auto difference = [&](int x1, int y1, int x2, int y2) {
+        double sum = 0.0;
+        for (int ch = 0; ch < 3; ++ch) {
+            double d = double(image[y1][x1][ch]) - double(image[y2][x2][ch]);
+            sum += d * d;
+        }
+        return std::sqrt(sum);
+    };
+
+    for (unsigned threads : {1u, 4u}) {
+        RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(image, labels, threads);
+        expectMatchesBruteForce(rag, image, labels, width, height, regions, difference);
+    }
+}
+
+TEST(RegionAdjacencyGraphTest, MismatchedLabelsThrow) {
+    GrayImage image(4, std::vector<uint8_t>(5, 0));
+    EXPECT_THROW(RegionAdjacencyGraph::fromLabels(image, std::vector<int>(19, 0)), std::invalid_argument);
+}
+
+TEST(RegionAdjacencyGraphTest, MergeRegionsMatchesNaiveSimulation) {
+    std::mt19937 rng(233);
+    for (int trial = 0; trial < 4; ++trial) {
+        const int width = 60, height = 50, regions = 30 + trial * 10;
+        std::vector<int> labels = randomLabels(rng, width, height, regions);
+        RGBImage image = randomImage(rng, labels, width, height, regions);
+        RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(image, labels, 1);
+
+        for (int target : {1, 5, regions / 2, regions}) {
+            EXPECT_EQ(rag.mergeRegions(target), naiveMerge(rag, target, std::numeric_limits<double>::infinity()))
+                << "target " << target;
+        }
+        for (double maxContrast : {-1.0, 20.0, 45.0, 80.0}) {
+            std::vector<int> regionMap = rag.mergeRegions(1, maxContrast);
+            EXPECT_EQ(regionMap, naiveMerge(rag, 1, maxContrast)) << "maxContrast " << maxContrast;
+        }
+
+        std::vector<int> none = rag.mergeRegions(regions);
+        std::vector<int> identity(regions);
+        std::iota(identity.begin(), identity.end(), 0);
+        EXPECT_EQ(none, identity);
+    }
+}
+
+TEST(RegionAdjacencyGraphTest, RelabelAppliesRegionMap) {
+    std::mt19937 rng(333);
+    const int width = 40, height = 35, regions = 25;
+    std::vector<int> labels = randomLabels(rng, width, height, regions);
+    RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(grayOf(randomImage(rng, labels, width, height, regions)),
+                                                                labels);
+    std::vector<int> regionMap = rag.mergeRegions(6);
+    std::vector<int> relabeled = RegionAdjacencyGraph::relabel(labels, regionMap);
+    ASSERT_EQ(relabeled.size(), labels.size());
+    for (size_t i = 0; i < labels.size(); ++i) EXPECT_EQ(relabeled[i], regionMap[labels[i]]);
+    EXPECT_EQ(*std::max_element(relabeled.begin(), relabeled.end()), 5);
+}
@@ -0,0 +1,212 @@
+#include <gtest/gtest.h>
+#include "region_ift.h"
+#include <limits>
+#include <map>
+#include <queue>
+#include <random>
+#include <stdexcept>
+
+namespace {
+    const double INF = std::numeric_limits<double>::infinity();
+
+    typedef std::vector<std::vector<uint8_t>> GrayImage;
+
+    Image toImage(const GrayImage& gray) {
+        Image image(gray[0].size(), gray.size());
+        for (size_t y = 0; y < gray.size(); ++y) {
+            for (size_t x = 0; x < gray[y].size(); ++x) image.setPixelValue(x, y, gray[y][x]);
+        }
+        return image;
+    }
+
+    // Dijkstra direto sobre as arestas do grafo de regiões, uma semente por região
+    // (menor handicap, empate: a primeira); retorna o custo de cada região
+    std::vector<double> dijkstra(const RegionAdjacencyGraph& rag, const PathCostFunction& costFunction,
+                                 const std::map<int, double>& regionHandicap) {
+        int regions = rag.getRegionCount();
+        std::vector<std::vector<std::pair<int, double>>> adjacency(regions);
+        for (const RegionEdge& edge : rag.getEdges()) {
+            adjacency[edge.a].push_back({edge.b, edge.contrast()});
+            adjacency[edge.b].push_back({edge.a, edge.contrast()});
+        }
+
+        std::vector<double> cost(regions, INF);
+        std::priority_queue<std::pair<double, int>, std::vector<std::pair<double, int>>, std::greater<>> queue;
+        for (const auto& entry : regionHandicap) {
+            cost[entry.first] = entry.second;
+            queue.push({entry.second, entry.first});
+        }
+        while (!queue.empty()) {
+            auto [c, v] = queue.top();
+            queue.pop();
+            if (c != cost[v]) continue;
+            for (const auto& [u, weight] : adjacency[v]) {
+                double extended = costFunction.extendCost(c, weight);
+                if (extended < cost[u]) {
+                    cost[u] = extended;
+                    queue.push({extended, u});
+                }
+            }
+        }
+        return cost;
+    }
+
+    double edgeContrast(const RegionAdjacencyGraph& rag, int a, int b) {
+        for (const RegionEdge& edge : rag.getEdges()) {
+            if (edge.a == std::min(a, b) && edge.b == std::max(a, b)) return edge.contrast();
+        }
+        return -1.0;
+    }
+}
+
+TEST(RegionIFTTest, LabelsSpreadAcrossRegionGraph) {
+    // Quatro faixas verticais (regiões 0..3): 0|1 e 2|3 têm contraste baixo,
+    // 1|2 é a borda forte. Cada semente conquista o seu lado da borda
+    const int width = 8, height = 3;
+    const uint8_t stripe[] = {10, 20, 200, 210};
+    GrayImage gray(height, std::vector<uint8_t>(width));
+    std::vector<int> labels(width * height);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            labels[y * width + x] = x / 2;
+            gray[y][x] = stripe[x / 2];
+        }
+    }
+    Image image = toImage(gray);
+    RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(gray, labels);
+    RegionIFT ift(rag, labels, width, height);
+    ASSERT_EQ(ift.getRegionCount(), 4);
+    EXPECT_EQ(ift.regionOf(5, 1), 2);
+
+    SeedSet seeds;
+    seeds.addSeed(image.getPixel(0, 1), 1);
+    seeds.addSeed(image.getPixel(7, 2), 2);
+    auto costFunction = createIntensityDifferenceMax();
+    ift.run(*costFunction, seeds);
+
+    EXPECT_EQ(ift.getRegionLabel(0), 1);
+    EXPECT_EQ(ift.getRegionLabel(1), 1);
+    EXPECT_EQ(ift.getRegionLabel(2), 2);
+    EXPECT_EQ(ift.getRegionLabel(3), 2);
+    EXPECT_DOUBLE_EQ(ift.getRegionCost(0), 0.0);
+    EXPECT_DOUBLE_EQ(ift.getRegionCost(1), 10.0);
+    EXPECT_DOUBLE_EQ(ift.getRegionCost(2), 10.0);
+    EXPECT_EQ(ift.getRegionPredecessor(1), 0);
+    EXPECT_EQ(ift.getRegionPredecessor(2), 3);
+    EXPECT_EQ(ift.getRegionPredecessor(0), -1);
+
+    // Projeção: cada pixel recebe o rótulo e o custo da sua faixa
+    std::vector<int> pixelLabels = ift.projectLabels();
+    std::vector<double> pixelCosts = ift.projectCosts();
+    std::unique_ptr<IFTResult> result = ift.toIFTResult(image);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int expectedLabel = x < 4 ? 1 : 2;
+            EXPECT_EQ(pixelLabels[y * width + x], expectedLabel);
+            EXPECT_DOUBLE_EQ(pixelCosts[y * width + x], ift.getRegionCost(x / 2));
+            EXPECT_EQ(result->getLabel(image.getPixel(x, y)), expectedLabel);
+            EXPECT_DOUBLE_EQ(result->getCost(image.getPixel(x, y)), ift.getRegionCost(x / 2));
+        }
+    }
+
+    // Nova execução sobre os mesmos buffers: duas sementes na mesma região,
+    // vale a de menor handicap
+    SeedSet edited;
+    edited.addSeed(image.getPixel(0, 0), 1, 5.0);
+    edited.addSeed(image.getPixel(1, 2), 3, 0.0);
+    ift.run(*costFunction, edited);
+    for (int region = 0; region < 4; ++region) EXPECT_EQ(ift.getRegionLabel(region), 3);
+    EXPECT_DOUBLE_EQ(ift.getRegionCost(3), 180.0);
+}
+
+TEST(RegionIFTTest, RegionCostsMatchDijkstraOnRegionGraph) {
+    std::mt19937 rng(34);
+    const int width = 48, height = 40;
+    for (int trial = 0; trial < 4; ++trial) {
+        // Blocos 8x8 com deslocamento aleatório por linha de blocos. O rótulo 0
+        // não tem pixels: a região existe no grafo, sem arestas, e nunca é conquistada
+        int blocksX = width / 8 + 1, blocksY = height / 8;
+        std::vector<int> labels(width * height);
+        GrayImage gray(height, std::vector<uint8_t>(width));
+        std::vector<uint8_t> base(blocksX * blocksY + 1);
+        for (uint8_t& value : base) value = rng() % 200;
+        for (int by = 0; by < blocksY; ++by) {
+            int shift = rng() % 8;
+            for (int y = by * 8; y < by * 8 + 8; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int region = 1 + by * blocksX + (x + shift) / 8;
+                    labels[y * width + x] = region;
+                    gray[y][x] = uint8_t(base[region] + rng() % 30);
+                }
+            }
+        }
+        Image image = toImage(gray);
+        RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(gray, labels);
+
+        RegionIFT ift(rag, labels, width, height);
+        SeedSet seeds;
+        std::map<int, double> regionHandicap;
+        for (int i = 0; i < 6; ++i) {
+            Pixel p = image.getPixel(rng() % width, rng() % height);
+            if (seeds.isSeed(p)) continue;
+            double handicap = double(rng() % 20);
+            seeds.addSeed(p, 1 + i % 3, handicap);
+            int region = ift.regionOf(p.x, p.y);
+            if (!regionHandicap.count(region) || handicap < regionHandicap[region]) regionHandicap[region] = handicap;
+        }
+
+        auto sum = createIntensityDifferenceSum();
+        auto max = createIntensityDifferenceMax();
+        for (const PathCostFunction* costFunction : {sum.get(), max.get()}) {
+            ift.run(*costFunction, seeds);
+            std::vector<double> expected = dijkstra(rag, *costFunction, regionHandicap);
+            const OptimumPathForest& forest = ift.getRegionForest();
+            for (int region = 0; region < ift.getRegionCount(); ++region) {
+                if (expected[region] == INF) {
+                    EXPECT_EQ(ift.getRegionCost(region), INF);
+                } else {
+                    EXPECT_NEAR(ift.getRegionCost(region), expected[region], 1e-9) << costFunction->getName();
+                }
+
+                // Cada região herda o rótulo do predecessor pelo arco que dá o seu custo
+                int predecessor = ift.getRegionPredecessor(region);
+                if (predecessor == -1) {
+                    // Raiz (região semente) ou região não alcançada
+                    EXPECT_EQ(ift.getRegionCost(region) < INF, regionHandicap.count(region) > 0) << "region " << region;
+                    if (!regionHandicap.count(region)) {
+                        EXPECT_EQ(forest.label[region], -1);
+                    }
+                    continue;
+                }
+                EXPECT_EQ(forest.label[region], forest.label[predecessor]);
+                EXPECT_NEAR(ift.getRegionCost(region),
+                            costFunction->extendCost(ift.getRegionCost(predecessor),
+                                                     edgeContrast(rag, region, predecessor)), 1e-9);
+            }
+
+            EXPECT_EQ(forest.label[0], -1);
+            std::vector<int> pixelLabels = ift.projectLabels();
+            for (size_t i = 0; i < labels.size(); ++i) EXPECT_EQ(pixelLabels[i], forest.label[labels[i]]);
+        }
+    }
+}
+
+TEST(RegionIFTTest, InvalidInputsThrow) {
+    GrayImage gray(3, std::vector<uint8_t>(4, 7));
+    std::vector<int> labels = {0, 0, 1, 1,
+                               0, 0, 1, 1,
+                               2, 2, 2, 2};
+    RegionAdjacencyGraph rag = RegionAdjacencyGraph::fromLabels(gray, labels);
+
+    EXPECT_THROW(RegionIFT(rag, labels, 4, 4), std::invalid_argument);
+    std::vector<int> outside = labels;
+    outside[5] = 3;
+    EXPECT_THROW(RegionIFT(rag, outside, 4, 3), std::invalid_argument);
+
+    RegionIFT ift(rag, labels, 4, 3);
+    SeedSet seeds;
+    seeds.addSeed(Pixel(4, 0, 7), 1);
+    auto costFunction = createIntensityDifferenceSum();
+    EXPECT_THROW(ift.run(*costFunction, seeds), std::out_of_range);
+    EXPECT_THROW(ift.toIFTResult(Image(3, 3)), std::invalid_argument);
+}
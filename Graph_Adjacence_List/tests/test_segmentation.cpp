@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+#include "Undirected_Graph.h"
+#include "utils/segmentation.h"
+#include "utils/imageToGraph.h"
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+namespace {
+    // Componentes 4-conexos de pixels iguais por BFS (rótulo = ordem de descoberta)
+    std::vector<int> flatZones(const std::vector<std::vector<uint8_t>>& image) {
+        int height = image.size(), width = image[0].size();
+        std::vector<int> zone(width * height, -1);
+        int next = 0;
+        for (int start = 0; start < width * height; ++start) {
+            if (zone[start] != -1) continue;
+            zone[start] = next;
+            std::queue<int> queue;
+            queue.push(start);
+            while (!queue.empty()) {
+                int v = queue.front();
+                queue.pop();
+                int x = v % width, y = v / width;
+                const int DX[] = {1, -1, 0, 0}, DY[] = {0, 0, 1, -1};
+                for (int d = 0; d < 4; ++d) {
+                    int nx = x + DX[d], ny = y + DY[d];
+                    int u = ny * width + nx;
+                    if (nx < 0 || nx >= width || ny < 0 || ny >= height || zone[u] != -1) continue;
+                    if (image[ny][nx] != image[y][x]) continue;
+                    zone[u] = next;
+                    queue.push(u);
+                }
+            }
+            next++;
+        }
+        return zone;
+    }
+
+    // Mesma partição e rótulos densos 0..k-1
+    void expectDensePartition(const std::vector<int>& labels, const std::vector<int>& reference) {
+        ASSERT_EQ(labels.size(), reference.size());
+        std::map<int, int> toLabel, toReference;
+        for (size_t i = 0; i < labels.size(); ++i) {
+            auto a = toLabel.insert({reference[i], labels[i]});
+            auto b = toReference.insert({labels[i], reference[i]});
+            ASSERT_EQ(a.first->second, labels[i]) << "vertex " << i;
+            ASSERT_EQ(b.first->second, reference[i]) << "vertex " << i;
+        }
+        int count = static_cast<int>(toReference.size());
+        EXPECT_EQ(toReference.begin()->first, 0);
+        EXPECT_EQ(toReference.rbegin()->first, count - 1);
+    }
+
+    // Estatísticas por força bruta, uma região de cada vez
+    template <typename PixelAccess>
+    std::vector<RegionStats> bruteForceStats(int width, int height, const std::vector<int>& labels,
+                                             PixelAccess pixelAt) {
+        int regionCount = *std::max_element(labels.begin(), labels.end()) + 1;
+        std::vector<RegionStats> stats(regionCount);
+        for (int r = 0; r < regionCount; ++r) {
+            RegionStats& s = stats[r];
+            s.minX = width;
+            s.minY = height;
+            std::array<double, 3> sum = {0.0, 0.0, 0.0};
+            std::set<int> neighbors;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    if (labels[y * width + x] != r) continue;
+                    s.area++;
+                    s.minX = std::min(s.minX, x);
+                    s.maxX = std::max(s.maxX, x);
+                    s.minY = std::min(s.minY, y);
+                    s.maxY = std::max(s.maxY, y);
+                    for (int ch = 0; ch < 3; ++ch) sum[ch] += pixelAt(x, y)[ch];
+                    const int DX[] = {1, -1, 0, 0}, DY[] = {0, 0, 1, -1};
+                    for (int d = 0; d < 4; ++d) {
+                        int nx = x + DX[d], ny = y + DY[d];
+                        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                        if (labels[ny * width + nx] != r) neighbors.insert(labels[ny * width + nx]);
+                    }
+                }
+            }
+            for (int ch = 0; ch < 3; ++ch) s.meanColor[ch] = s.area > 0 ? sum[ch] / s.area : 0.0;
+            s.neighbors.assign(neighbors.begin(), neighbors.end());
+        }
+        return stats;
+    }
+
+    void expectSameStats(const std::vector<RegionStats>& actual, const std::vector<RegionStats>& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t r = 0; r < actual.size(); ++r) {
+            EXPECT_EQ(actual[r].area, expected[r].area) << "region " << r;
+            EXPECT_EQ(actual[r].minX, expected[r].minX) << "region " << r;
+            EXPECT_EQ(actual[r].minY, expected[r].minY) << "region " << r;
+            EXPECT_EQ(actual[r].maxX, expected[r].maxX) << "region " << r;
+            EXPECT_EQ(actual[r].maxY, expected[r].maxY) << "region " << r;
+            for (int ch = 0; ch < 3; ++ch) EXPECT_NEAR(actual[r].meanColor[ch], expected[r].meanColor[ch], 1e-9);
+            EXPECT_EQ(actual[r].neighbors, expected[r].neighbors) << "region " << r;
+        }
+    }
+}
+
+TEST(SegmentationTest, TiledSegmentationMergesSmallComponentsPerTile) {
+    const int width = 24, height = 20;
+    UndirectedGraph g;
+    for (int i = 0; i < width * height; ++i) g.addVertex(std::to_string(i));
+
+    std::mt19937 rng(7);
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            if (x + 1 < width) g.addEdge(std::to_string(v), std::to_string(v + 1), double(rng() % 40));
+            if (y + 1 < height) g.addEdge(std::to_string(v), std::to_string(v + width), double(rng() % 40));
+        }
+    }
+
+    const int minSize = 12;
+
+    // Um único bloco: mesma ordem de arestas da versão sequencial
+    EXPECT_EQ(Segmentation::segmentGraphTiled(g, width, height, 30.0, minSize, 64, 2),
+              Segmentation::segmentGraph(g, 30.0, minSize));
+
+    // Blocos pequenos: determinístico e nenhum componente abaixo de min_size
+    auto labels = Segmentation::segmentGraphTiled(g, width, height, 30.0, minSize, 5, 1);
+    EXPECT_EQ(labels, Segmentation::segmentGraphTiled(g, width, height, 30.0, minSize, 5, 4));
+
+    std::vector<int> area(*std::max_element(labels.begin(), labels.end()) + 1, 0);
+    for (int label : labels) area[label]++;
+    for (int a : area) EXPECT_GE(a, minSize);
+}
+
+TEST(SegmentationTest, TiledSegmentationOfConvertedImage) {
+    // O grafo do ImageGraphConverter precisa numerar os vértices em ordem
+    // row-major: os blocos de segmentGraphTiled são calculados pelo índice
+    const int width = 23, height = 17;
+    std::mt19937 rng(27);
+    std::vector<std::vector<uint8_t>> image(height, std::vector<uint8_t>(width));
+    for (auto& row : image) {
+        for (auto& value : row) value = static_cast<uint8_t>(rng() % 50);
+    }
+
+    UndirectedGraph converted;
+    ImageGraphConverter::imageToGraphGray(image, converted);
+
+    UndirectedGraph expected;
+    for (int i = 0; i < width * height; ++i) expected.addVertex(std::to_string(i));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int v = y * width + x;
+            if (x + 1 < width) expected.addEdge(std::to_string(v), std::to_string(v + 1), std::abs(image[y][x] - image[y][x + 1]));
+            if (y + 1 < height) expected.addEdge(std::to_string(v), std::to_string(v + width), std::abs(image[y][x] - image[y + 1][x]));
+        }
+    }
+
+    auto labelToIndex = converted.getLabeltoIndex();
+    for (int i = 0; i < width * height; ++i) ASSERT_EQ(labelToIndex[std::to_string(i)], i);
+    EXPECT_EQ(Segmentation::segmentGraphTiled(converted, width, height, 20.0, 8, 6, 2),
+              Segmentation::segmentGraphTiled(expected, width, height, 20.0, 8, 6, 2));
+}
+
+TEST(SegmentationTest, FinalComponentsHaveDenseLabels) {
+    // k = 0 e min_size = 1: só as arestas de peso 0 unem, então os componentes
+    // são as zonas planas. 300 x 200 vértices dão vários blocos no prefixo paralelo
+    const int width = 300, height = 200;
+    std::mt19937 rng(31);
+    std::vector<std::vector<uint8_t>> image(height, std::vector<uint8_t>(width));
+    for (auto& row : image) {
+        for (auto& value : row) value = static_cast<uint8_t>((rng() % 3) * 100);
+    }
+    std::vector<int> zones = flatZones(image);
+
+    UndirectedGraph graph;
+    ImageGraphConverter::imageToGraphGray(image, graph);
+
+    expectDensePartition(Segmentation::segmentGraph(graph, 0.0, 1), zones);
+    std::vector<int> tiled = Segmentation::segmentGraphTiled(graph, width, height, 0.0, 1, 64, 4);
+    expectDensePartition(tiled, zones);
+    EXPECT_EQ(tiled, Segmentation::segmentGraphTiled(graph, width, height, 0.0, 1, 64, 1));
+}
+
+TEST(SegmentationTest, RegionStatsMatchBruteForce) {
+    // Altura 200: três blocos de linhas com 4 threads
+    const int width = 37, height = 200;
+    std::mt19937 rng(131);
+    std::vector<std::vector<uint8_t>> gray(height, std::vector<uint8_t>(width));
+    std::vector<std::vector<std::array<uint8_t, 3>>> rgb(height, std::vector<std::array<uint8_t, 3>>(width));
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            gray[y][x] = static_cast<uint8_t>((x / 9 + y / 23) * 20 + rng() % 12);
+            rgb[y][x] = {static_cast<uint8_t>(rng() % 256), gray[y][x], static_cast<uint8_t>(rng() % 256)};
+        }
+    }
+
+    UndirectedGraph graph;
+    ImageGraphConverter::imageToGraphGray(gray, graph);
+    std::vector<int> labels = Segmentation::segmentGraph(graph, 40.0, 15);
+
+    auto grayAt = [&](int x, int y) { return std::array<uint8_t, 3>{gray[y][x], gray[y][x], gray[y][x]}; };
+    auto rgbAt = [&](int x, int y) { return rgb[y][x]; };
+    std::vector<RegionStats> expectedGray = bruteForceStats(width, height, labels, grayAt);
+    std::vector<RegionStats> expectedRGB = bruteForceStats(width, height, labels, rgbAt);
+    ASSERT_GT(expectedGray.size(), 3u);
+
+    for (unsigned threads : {1u, 4u}) {
+        expectSameStats(Segmentation::computeRegionStats(gray, labels, threads), expectedGray);
+        expectSameStats(Segmentation::computeRegionStats(rgb, labels, threads), expectedRGB);
+    }
+}
+
+TEST(SegmentationTest, RegionStatsRejectInvalidLabels) {
+    std::vector<std::vector<uint8_t>> image(3, std::vector<uint8_t>(4, 10));
+    std::vector<int> labels(12, 0);
+    EXPECT_THROW(Segmentation::computeRegionStats(image, std::vector<int>(11, 0)), std::invalid_argument);
+
+    labels[5] = -1;
+    EXPECT_THROW(Segmentation::computeRegionStats(image, labels), std::invalid_argument);
+    labels[5] = 12;
+    EXPECT_THROW(Segmentation::computeRegionStats(image, labels), std::invalid_argument);
+    labels[5] = 11;
+    EXPECT_EQ(Segmentation::computeRegionStats(image, labels).size(), 12u);
+}
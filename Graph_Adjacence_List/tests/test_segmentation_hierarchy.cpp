@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include "Undirected_Graph.h"
+#include "utils/segmentation_hierarchy.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <random>
+
+namespace {
+    typedef std::tuple<double, int, int> WeightedEdge;
+
+    int findRoot(std::vector<int>& parent, int v) {
+        while (parent[v] != v) v = parent[v] = parent[parent[v]];
+        return v;
+    }
+
+    // Kruskal de referência: une em ordem de (peso, u, v) enquanto keep(aresta,
+    // fusões já feitas) e devolve a raiz de cada vértice
+    template <typename Keep>
+    std::vector<int> kruskal(int n, std::vector<WeightedEdge> edges, Keep keep) {
+        std::sort(edges.begin(), edges.end());
+        std::vector<int> parent(n);
+        std::iota(parent.begin(), parent.end(), 0);
+        int merges = 0;
+        for (const WeightedEdge& edge : edges) {
+            int a = findRoot(parent, std::get<1>(edge)), b = findRoot(parent, std::get<2>(edge));
+            if (a == b) continue;
+            if (!keep(edge, merges)) break;
+            parent[a] = b;
+            merges++;
+        }
+        std::vector<int> roots(n);
+        for (int v = 0; v < n; ++v) roots[v] = findRoot(parent, v);
+        return roots;
+    }
+
+    // Mesma partição e rótulos densos 0..k-1; retorna k
+    int expectDensePartition(const std::vector<int>& labels, const std::vector<int>& reference) {
+        EXPECT_EQ(labels.size(), reference.size());
+        std::map<int, int> toLabel, toReference;
+        for (size_t i = 0; i < labels.size(); ++i) {
+            auto a = toLabel.insert({reference[i], labels[i]});
+            auto b = toReference.insert({labels[i], reference[i]});
+            EXPECT_EQ(a.first->second, labels[i]) << "vertex " << i;
+            EXPECT_EQ(b.first->second, reference[i]) << "vertex " << i;
+        }
+        int count = static_cast<int>(toReference.size());
+        if (count > 0) {
+            EXPECT_EQ(toReference.begin()->first, 0);
+            EXPECT_EQ(toReference.rbegin()->first, count - 1);
+        }
+        return count;
+    }
+
+    // Grafo aleatório com pesos inteiros repetidos (empates) e, às vezes,
+    // vértices isolados (mais de uma componente conexa)
+    std::vector<WeightedEdge> randomEdges(std::mt19937& rng, int n, int m) {
+        std::vector<WeightedEdge> edges;
+        for (int i = 0; i < m; ++i) {
+            int u = rng() % n, v = rng() % n;
+            if (u == v) continue;
+            edges.emplace_back(double(rng() % 12), std::min(u, v), std::max(u, v));
+        }
+        return edges;
+    }
+
+    SegmentationHierarchy hierarchyOf(int n, std::vector<WeightedEdge> edges) {
+        std::sort(edges.begin(), edges.end());
+        return SegmentationHierarchy::fromSortedEdges(n, edges);
+    }
+
+    std::string tempFile(const std::string& name) {
+        return (std::filesystem::temp_directory_path() / name).string();
+    }
+}
+
+TEST(SegmentationHierarchyTest, CutAtAltitudeMatchesThresholdedComponents) {
+    std::mt19937 rng(32);
+    for (int trial = 0; trial < 6; ++trial) {
+        int n = 20 + rng() % 80;
+        std::vector<WeightedEdge> edges = randomEdges(rng, n, n + rng() % (2 * n));
+        SegmentationHierarchy hierarchy = hierarchyOf(n, edges);
+        EXPECT_EQ(hierarchy.getLeafCount(), n);
+
+        for (double threshold : {-1.0, 0.0, 3.0, 5.5, 11.0}) {
+            std::vector<int> expected = kruskal(n, edges, [&](const WeightedEdge& edge, int) {
+                return std::get<0>(edge) <= threshold;
+            });
+            expectDensePartition(hierarchy.cutAtAltitude(threshold), expected);
+        }
+    }
+}
+
+TEST(SegmentationHierarchyTest, CutToRegionCountFollowsKruskalOrder) {
+    std::mt19937 rng(132);
+    for (int trial = 0; trial < 6; ++trial) {
+        int n = 20 + rng() % 80;
+        std::vector<WeightedEdge> edges = randomEdges(rng, n, n + rng() % (2 * n));
+        SegmentationHierarchy hierarchy = hierarchyOf(n, edges);
+        int components = n - hierarchy.getMergeCount();
+
+        for (int regions : {1, 2, 5, n / 2, n, n + 3}) {
+            // As primeiras n - regions fusões, com empates na ordem (peso, u, v)
+            std::vector<int> expected = kruskal(n, edges, [&](const WeightedEdge&, int merges) {
+                return merges < n - regions;
+            });
+            int count = expectDensePartition(hierarchy.cutToRegionCount(regions), expected);
+            EXPECT_EQ(count, std::min(n, std::max(regions, components))) << regions << " regions";
+        }
+    }
+}
+
+TEST(SegmentationHierarchyTest, BuildFromGraphMatchesSortedEdges) {
+    std::mt19937 rng(232);
+    UndirectedGraph graph;
+    const int n = 40;
+    for (int i = 0; i < n; ++i) graph.addVertex(std::to_string(i));
+    for (const WeightedEdge& edge : randomEdges(rng, n, 90)) {
+        graph.addEdge(std::to_string(std::get<1>(edge)), std::to_string(std::get<2>(edge)), std::get<0>(edge));
+    }
+
+    SegmentationHierarchy built = SegmentationHierarchy::build(graph);
+    SegmentationHierarchy expected = hierarchyOf(n, graph.getEdgeList());
+    ASSERT_EQ(built.getNodeCount(), expected.getNodeCount());
+    for (int node = 0; node < built.getNodeCount(); ++node) {
+        EXPECT_EQ(built.getParent(node), expected.getParent(node));
+        EXPECT_EQ(built.getAltitude(node), expected.getAltitude(node));
+    }
+}
+
+TEST(SegmentationHierarchyTest, SaveAndLoadRoundTrip) {
+    std::mt19937 rng(332);
+    const int n = 60;
+    SegmentationHierarchy hierarchy = hierarchyOf(n, randomEdges(rng, n, 100));
+    std::string path = tempFile("segmentation_hierarchy_roundtrip.sht");
+    ASSERT_TRUE(hierarchy.save(path));
+
+    SegmentationHierarchy loaded;
+    ASSERT_TRUE(SegmentationHierarchy::load(path, loaded));
+    EXPECT_EQ(loaded.getLeafCount(), n);
+    ASSERT_EQ(loaded.getNodeCount(), hierarchy.getNodeCount());
+    for (int node = 0; node < hierarchy.getNodeCount(); ++node) {
+        EXPECT_EQ(loaded.getParent(node), hierarchy.getParent(node));
+        EXPECT_EQ(loaded.getAltitude(node), hierarchy.getAltitude(node));
+    }
+    EXPECT_EQ(loaded.cutAtAltitude(4.0), hierarchy.cutAtAltitude(4.0));
+    EXPECT_EQ(loaded.cutToRegionCount(7), hierarchy.cutToRegionCount(7));
+    std::remove(path.c_str());
+}
+
+TEST(SegmentationHierarchyTest, LoadRejectsCorruptFiles) {
+    std::mt19937 rng(432);
+    const int n = 30;
+    SegmentationHierarchy hierarchy = hierarchyOf(n, randomEdges(rng, n, 60));
+    std::string path = tempFile("segmentation_hierarchy_corrupt.sht");
+    ASSERT_TRUE(hierarchy.save(path));
+
+    std::ifstream in(path, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ASSERT_EQ(bytes.size(), 12 + hierarchy.getNodeCount() * (sizeof(int32_t) + sizeof(double)));
+
+    auto loadBytes = [&](const std::string& content) {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(content.data(), content.size());
+        out.close();
+        // Em caso de falha o destino fica intacto
+        SegmentationHierarchy target = hierarchyOf(3, {WeightedEdge(1.0, 0, 1)});
+        bool ok = SegmentationHierarchy::load(path, target);
+        if (!ok) {
+            EXPECT_EQ(target.getLeafCount(), 3);
+            EXPECT_EQ(target.getNodeCount(), 4);
+        }
+        return ok;
+    };
+
+    EXPECT_TRUE(loadBytes(bytes));
+
+    std::string badMagic = bytes;
+    badMagic[3] = '2';
+    EXPECT_FALSE(loadBytes(badMagic));
+
+    // Truncado no cabeçalho, nos pais e nas altitudes
+    EXPECT_FALSE(loadBytes(bytes.substr(0, 6)));
+    EXPECT_FALSE(loadBytes(bytes.substr(0, 12 + 5 * sizeof(int32_t))));
+    EXPECT_FALSE(loadBytes(bytes.substr(0, bytes.size() - 1)));
+    EXPECT_FALSE(loadBytes(""));
+
+    // Pai com índice menor que o filho quebra a invariante dos cortes
+    std::string badParent = bytes;
+    int32_t self = 0;
+    std::memcpy(&badParent[12], &self, sizeof(self));
+    EXPECT_FALSE(loadBytes(badParent));
+
+    std::remove(path.c_str());
+    SegmentationHierarchy missing;
+    EXPECT_FALSE(SegmentationHierarchy::load(tempFile("segmentation_hierarchy_missing.sht"), missing));
+}
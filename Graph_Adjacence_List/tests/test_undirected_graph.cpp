@@ -1,6 +1,6 @@
 #include <gtest/gtest.h>
 #include "Undirected_Graph.h"
-#include <algorithm>
+#include "utils/csr_graph.h"
 
 TEST(UndirectedGraphTest, AddEdgeSuccessfullyCreatesBidirectionalLink) {
     UndirectedGraph g;
@@ -64,3 +64,59 @@ TEST(UndirectedGraphTest, RemoveEdgeThrowsIfEdgeDoesNotExist) {
     EXPECT_THROW(g.removeEdge("A", "B"), std::runtime_error);
 }
 
+
+TEST(UndirectedGraphTest, MinimumSpanningForestPicksLightestTree) {
+    UndirectedGraph g;
+    for (const std::string label : {"A", "B", "C", "D"}) g.addVertex(label);
+
+    g.addEdge("A", "B", 1.0);
+    g.addEdge("B", "C", 4.0);
+    g.addEdge("A", "C", 2.0);
+    g.addEdge("C", "D", 3.0);
+    g.addEdge("B", "D", 5.0);
+
+    auto edges = g.getEdgeList();
+    auto forest = g.minimumSpanningForest();
+
+    ASSERT_EQ(forest.size(), 3);
+    double total = 0.0;
+    for (int e : forest) total += std::get<0>(edges[e]);
+    EXPECT_DOUBLE_EQ(total, 6.0);
+}
+
+TEST(UndirectedGraphTest, MinimumSpanningForestHandlesDisconnectedGraph) {
+    UndirectedGraph g;
+    for (const std::string label : {"A", "B", "C", "D", "E"}) g.addVertex(label);
+
+    g.addEdge("A", "B", 2.0);
+    g.addEdge("A", "B", 1.0);  // aresta paralela mais leve
+    g.addEdge("C", "D", 7.0);
+
+    auto edges = g.getEdgeList();
+    auto forest = g.minimumSpanningForest();
+
+    ASSERT_EQ(forest.size(), 2);
+    EXPECT_DOUBLE_EQ(std::get<0>(edges[forest[0]]), 1.0);
+    EXPECT_DOUBLE_EQ(std::get<0>(edges[forest[1]]), 7.0);
+}
+
+TEST(UndirectedGraphTest, CSRGraphMirrorsAdjacency) {
+    UndirectedGraph g;
+    for (const std::string label : {"A", "B", "C"}) g.addVertex(label);
+
+    g.addEdge("A", "B", 1.0);
+    g.addEdge("B", "C", 2.5);
+
+    CSRGraph csr = CSRGraph::fromGraph(g);
+
+    ASSERT_EQ(csr.getVertexCount(), 3);
+    EXPECT_EQ(csr.getArcCount(), 4);
+    EXPECT_EQ(csr.degree(0), 1);
+    EXPECT_EQ(csr.degree(1), 2);
+    EXPECT_EQ(csr.arcTarget(csr.arcBegin(2)), 1);
+    EXPECT_DOUBLE_EQ(csr.arcWeight(csr.arcBegin(2)), 2.5);
+
+    UndirectedGraph copy;
+    csr.toUndirectedGraph(copy);
+    EXPECT_EQ(copy.getEdgeList(), g.getEdgeList());
+}
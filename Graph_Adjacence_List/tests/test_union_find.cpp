@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+#include "utils/union_find.h"
+#include "utils/concurrent_union_find.h"
+#include <algorithm>
+#include <random>
+#include <thread>
+
+namespace {
+    // Cadeia 0-1-2-...-(n-1) unida em ordem, com milhões de elementos: find
+    // iterativo e união por tamanho, todos os finds chegam à mesma raiz
+    template <typename Index>
+    void expectLongChainJoins(Index n) {
+        BasicUnionFind<Index> ds(n);
+        EXPECT_EQ(ds.elementCount(), n);
+        double maxWeight = 0.0;
+        for (Index i = 0; i + 1 < n; ++i) {
+            double weight = static_cast<double>(i % 97);
+            maxWeight = std::max(maxWeight, weight);
+            ASSERT_TRUE(ds.join(i, i + 1, weight, 1e12));
+        }
+
+        Index root = ds.findRoot(n - 1);
+        EXPECT_EQ(ds.getRootSize(root), n);
+        for (Index i = 0; i < n; i += 997) EXPECT_EQ(ds.findRoot(i), root);
+        for (Index i = n - 1; i >= 0; --i) ASSERT_EQ(ds.find(i), root);
+        EXPECT_EQ(ds.getSize(0), n);
+        EXPECT_EQ(ds.getInternalDiff(n / 2), maxWeight);
+        EXPECT_FALSE(ds.join(0, n - 1, 0.0, 1e12));
+    }
+}
+
+TEST(UnionFindTest, ConcurrentUnionFindMatchesSequentialPartition) {
+    const int n = 3000, threadCount = 4, opsPerThread = 4000;
+    ConcurrentUnionFind concurrent(n);
+
+    struct Op { int u, v; double weight; bool isJoin, merged; };
+    std::vector<std::vector<Op>> ops(threadCount);
+    for (int t = 0; t < threadCount; ++t) {
+        std::mt19937 rng(100 + t);
+        for (int i = 0; i < opsPerThread; ++i) {
+            ops[t].push_back({int(rng() % n), int(rng() % n), (rng() % 640) / 10.0, rng() % 4 != 0, false});
+        }
+    }
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threadCount; ++t) {
+        workers.emplace_back([&, t]() {
+            for (Op& op : ops[t]) {
+                op.merged = op.isJoin ? concurrent.join(op.u, op.v, op.weight, 20.0)
+                                      : concurrent.unite(op.u, op.v);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+
+    // Partição = união sequencial das operações que retornaram true; cada uma
+    // uniu dois conjuntos distintos
+    UnionFind sequential(n);
+    int merges = 0;
+    std::vector<double> maxWeight(n, 0.0);
+    for (const auto& list : ops) {
+        for (const Op& op : list) {
+            if (!op.merged) continue;
+            merges++;
+            sequential.forceJoin(op.u, op.v);
+        }
+    }
+    for (const auto& list : ops) {
+        for (const Op& op : list) {
+            if (op.merged && op.isJoin) {
+                int root = sequential.find(op.u);
+                maxWeight[root] = std::max(maxWeight[root], op.weight);
+            }
+            if (!op.isJoin) {
+                EXPECT_TRUE(concurrent.sameSet(op.u, op.v));
+            }
+        }
+    }
+
+    int components = 0;
+    for (int v = 0; v < n; ++v) {
+        int root = sequential.find(v);
+        if (root == v) components++;
+        EXPECT_EQ(concurrent.getSize(v), sequential.getSize(v));
+        EXPECT_EQ(concurrent.getInternalDiff(v), maxWeight[root]);
+        EXPECT_EQ(concurrent.find(v), concurrent.find(sequential.find(v)));
+    }
+    EXPECT_EQ(merges, n - components);
+}
+
+TEST(UnionFindTest, ConcurrentUnionFindKeepsInternalDiffExact) {
+    // 0.7 não é exato em float (arredonda para baixo): o empate do predicado
+    // 0.7 + 4/2 só é aceito se a diferença interna é guardada em double
+    UnionFind sequential(3);
+    ConcurrentUnionFind concurrent(3);
+    const double k = 4.0;
+
+    EXPECT_TRUE(sequential.join(0, 1, 0.7, k));
+    EXPECT_TRUE(concurrent.join(0, 1, 0.7, k));
+    EXPECT_EQ(concurrent.getInternalDiff(1), 0.7);
+
+    double tie = 0.7 + k / 2;
+    EXPECT_TRUE(sequential.join(1, 2, tie, k));
+    EXPECT_TRUE(concurrent.join(1, 2, tie, k));
+    EXPECT_EQ(concurrent.getInternalDiff(2), sequential.getInternalDiff(2));
+    EXPECT_EQ(concurrent.getSize(0), 3);
+}
+
+TEST(UnionFindTest, LongChainDoesNotOverflow) {
+    expectLongChainJoins<int32_t>(1 << 21);
+}
+
+TEST(UnionFindTest, UnionFind64MatchesUnionFind) {
+    expectLongChainJoins<int64_t>(1 << 20);
+
+    // Mesmas operações nas duas larguras de índice: mesma partição, tamanhos e diferenças
+    const int n = 5000;
+    UnionFind narrow(n);
+    UnionFind64 wide(n);
+    std::mt19937 rng(28);
+    for (int i = 0; i < 8000; ++i) {
+        int u = rng() % n, v = rng() % n;
+        double weight = (rng() % 500) / 10.0;
+        if (rng() % 3 == 0) {
+            narrow.forceJoin(u, v);
+            wide.forceJoin(u, v);
+        } else {
+            EXPECT_EQ(narrow.join(u, v, weight, 30.0), wide.join(u, v, weight, 30.0));
+        }
+    }
+    for (int v = 0; v < n; ++v) {
+        EXPECT_EQ(narrow.find(v), wide.find(v));
+        EXPECT_EQ(narrow.getSize(v), wide.getSize(v));
+        EXPECT_EQ(narrow.getInternalDiff(v), wide.getInternalDiff(v));
+    }
+}
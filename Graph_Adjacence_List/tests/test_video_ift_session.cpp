@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include "video_ift_session.h"
+#include <algorithm>
+#include <random>
+
+namespace {
+    Image gradientImage(int width, int height) {
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                image.setPixelValue(x, y, static_cast<uint8_t>(40 + 5 * x + 3 * y));
+            }
+        }
+        return image;
+    }
+
+    void expectSameCosts(const OptimumPathForest& actual, const OptimumPathForest& expected) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (int v = 0; v < actual.size(); ++v) {
+            EXPECT_DOUBLE_EQ(actual.cost[v], expected.cost[v]) << "pixel " << v;
+            ASSERT_TRUE(actual.isConquered(v));
+            EXPECT_EQ(actual.label[v], actual.label[actual.root[v]]);
+        }
+    }
+}
+
+TEST(VideoIFTSessionTest, IncrementalFrameMatchesFreshRunOnReference) {
+    const int width = 16, height = 16, threshold = 8;
+    auto costFunction = createIntensityDifferenceSum();
+
+    SeedSet seeds;
+    seeds.addSeed(Pixel(1, 1, 0), 1);
+    seeds.addSeed(Pixel(14, 13, 0), 2);
+
+    Image first = gradientImage(width, height);
+    VideoIFTSession session(*costFunction, threshold);
+    session.processFrame(first, seeds);
+
+    // Quadro 2: ruído de ±3 (abaixo do limiar) e um bloco 3x3 alterado em +60
+    std::mt19937 rng(11);
+    Image second = first;
+    Image reference = first;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            int value = first.getPixelValue(x, y);
+            bool patch = x >= 6 && x < 9 && y >= 5 && y < 8;
+            int noisy = patch ? value + 60 : value + static_cast<int>(rng() % 7) - 3;
+            second.setPixelValue(x, y, static_cast<uint8_t>(noisy));
+            if (patch) reference.setPixelValue(x, y, static_cast<uint8_t>(noisy));
+        }
+    }
+
+    const OptimumPathForest& incremental = session.processFrame(second, seeds);
+    EXPECT_FALSE(session.getLastFrameStats().fullRun);
+    EXPECT_EQ(session.getLastFrameStats().changedPixels, 9u);
+
+    VideoIFTSession fresh(*costFunction, threshold);
+    expectSameCosts(incremental, fresh.processFrame(reference, seeds));
+
+    // Quadro 3: uma semente se move; a referência não muda
+    SeedSet moved;
+    moved.addSeed(Pixel(1, 1, 0), 1);
+    moved.addSeed(Pixel(12, 14, 0), 2);
+    const OptimumPathForest& afterMove = session.processFrame(second, moved);
+    EXPECT_EQ(session.getLastFrameStats().changedPixels, 0u);
+
+    VideoIFTSession freshMoved(*costFunction, threshold);
+    expectSameCosts(afterMove, freshMoved.processFrame(reference, moved));
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "volume_ift.h"
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <random>
+
+namespace {
+    Volume randomVolume(int width, int height, int depth, unsigned seed) {
+        std::mt19937 rng(seed);
+        Volume volume(width, height, depth);
+        for (int z = 0; z < depth; ++z) {
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    volume.setVoxelValue(x, y, z, static_cast<uint8_t>((x > width / 2 ? 150 : 30) + rng() % 40));
+                }
+            }
+        }
+        return volume;
+    }
+
+    // Dijkstra de referência com a mesma composição de custo
+    std::vector<double> referenceCosts(const Volume& volume, const PathCostFunction& costFunction,
+                                       const std::vector<VoxelSeed>& seeds, int connectivity) {
+        VolumeAdjacency adjacency = VolumeAdjacency::create(connectivity);
+        std::vector<double> cost(volume.getVoxelCount(), std::numeric_limits<double>::infinity());
+        typedef std::pair<double, int64_t> Entry;
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        for (const VoxelSeed& seed : seeds) {
+            int64_t i = volume.index(seed.voxel.x, seed.voxel.y, seed.voxel.z);
+            if (seed.handicap < cost[i]) {
+                cost[i] = seed.handicap;
+                queue.push({cost[i], i});
+            }
+        }
+        while (!queue.empty()) {
+            Entry top = queue.top();
+            queue.pop();
+            if (top.first > cost[top.second]) continue;
+            Voxel s = Voxel::fromLinearIndex(top.second, volume.getWidth(), volume.getHeight());
+            for (int d = 0; d < adjacency.size(); ++d) {
+                int x = s.x + adjacency.dx[d], y = s.y + adjacency.dy[d], z = s.z + adjacency.dz[d];
+                if (!volume.isValidCoordinate(x, y, z)) continue;
+                int64_t t = volume.index(x, y, z);
+                Image probe(2, 1);
+                double w = costFunction.getArcWeight(Pixel(0, 0, volume.at(top.second)),
+                                                     Pixel(1, 0, volume.at(t)), probe);
+                double extended = costFunction.extendCost(top.first, w);
+                if (extended < cost[t]) {
+                    cost[t] = extended;
+                    queue.push({extended, t});
+                }
+            }
+        }
+        return cost;
+    }
+}
+
+TEST(VolumeIFTTest, CostsMatchDijkstraAndStorageIsNarrow) {
+    Volume volume = randomVolume(12, 10, 8, 5);
+    std::vector<VoxelSeed> seeds = {VoxelSeed(Voxel(1, 1, 1), 7), VoxelSeed(Voxel(10, 8, 6), 9),
+                                    VoxelSeed(Voxel(5, 5, 3), 7, 20)};
+
+    for (int connectivity : {6, 26}) {
+        for (bool maxCost : {false, true}) {
+            auto costFunction = maxCost ? createIntensityDifferenceMax() : createIntensityDifferenceSum();
+            VolumeIFT ift(connectivity, true);
+            VolumeIFTResult result = ift.run(volume, *costFunction, seeds);
+            std::vector<double> expected = referenceCosts(volume, *costFunction, seeds, connectivity);
+
+            // f_max: custo limitado ao maior peso, 2 + 1 + 1 bytes por voxel;
+            // f_sum: limite do caminho mais longo passa de 16 bits neste volume
+            EXPECT_EQ(result.getCostBits(), maxCost ? 16 : 32);
+            EXPECT_EQ(result.getLabelBits(), 8);
+            EXPECT_EQ(result.memoryBytes(), size_t(volume.getVoxelCount()) * (maxCost ? 4 : 6));
+
+            for (int64_t i = 0; i < volume.getVoxelCount(); ++i) {
+                ASSERT_EQ(result.getCost(i), expected[i]) << "voxel " << i;
+                int label = result.getLabel(i);
+                EXPECT_TRUE(label == 7 || label == 9);
+
+                // O predecessor tem o mesmo rótulo e estende até o custo do voxel
+                int64_t p = result.getPredecessor(i);
+                if (p < 0) continue;
+                EXPECT_EQ(result.getLabel(p), label);
+                double w = std::abs(double(volume.at(p)) - volume.at(i));
+                EXPECT_EQ(costFunction->extendCost(result.getCost(p), w), result.getCost(i));
+            }
+        }
+    }
+}
+
+TEST(VolumeIFTTest, WideCostsHoldPathCostsAbove16Bits) {
+    Volume volume = randomVolume(40, 40, 48, 6);
+    std::vector<VoxelSeed> seeds = {VoxelSeed(Voxel(0, 0, 0), 1)};
+    auto costFunction = createConstantSum(2000.0);   // até 125 passos: 250000
+
+    VolumeIFTResult result = VolumeIFT(6).run(volume, *costFunction, seeds);
+    std::vector<double> expected = referenceCosts(volume, *costFunction, seeds, 6);
+
+    EXPECT_EQ(result.getCostBits(), 32);
+    for (int64_t i = 0; i < volume.getVoxelCount(); ++i) ASSERT_EQ(result.getCost(i), expected[i]);
+    EXPECT_EQ(result.getCost(39, 39, 47), 2000 * (39 + 39 + 47));
+}
@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+#include "watershed.h"
+#include <algorithm>
+#include <cstdlib>
+#include <queue>
+#include <random>
+
+namespace {
+    const int DX[] = {0, -1, 1, 0, -1, 1, -1, 1};
+    const int DY[] = {-1, 0, 0, 1, -1, -1, 1, 1};
+    const int UNREACHED = 1 << 20;
+
+    // Relevo por pixel com borda replicada, como no WatershedTransform
+    std::vector<int> reliefOf(const Image& image, WatershedTransform::Relief relief) {
+        int width = image.getWidth(), height = image.getHeight();
+        auto at = [&](int x, int y) {
+            return static_cast<int>(image.getPixelValue(std::min(std::max(x, 0), width - 1),
+                                                        std::min(std::max(y, 0), height - 1)));
+        };
+
+        std::vector<int> result(static_cast<size_t>(width) * height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) {
+                int value = at(x, y);
+                if (relief == WatershedTransform::Relief::Sobel) {
+                    int gx = at(x + 1, y - 1) + 2 * at(x + 1, y) + at(x + 1, y + 1) -
+                             at(x - 1, y - 1) - 2 * at(x - 1, y) - at(x - 1, y + 1);
+                    int gy = at(x - 1, y + 1) + 2 * at(x, y + 1) + at(x + 1, y + 1) -
+                             at(x - 1, y - 1) - 2 * at(x, y - 1) - at(x + 1, y - 1);
+                    value = (std::abs(gx) + std::abs(gy)) / 8;
+                } else if (relief == WatershedTransform::Relief::Morphological) {
+                    int lo = 255, hi = 0;
+                    for (int dy = -1; dy <= 1; ++dy) {
+                        for (int dx = -1; dx <= 1; ++dx) {
+                            lo = std::min(lo, at(x + dx, y + dy));
+                            hi = std::max(hi, at(x + dx, y + dy));
+                        }
+                    }
+                    value = hi - lo;
+                }
+                result[static_cast<size_t>(y) * width + x] = value;
+            }
+        }
+        return result;
+    }
+
+    // Dijkstra minimax: menor f_max de um caminho a partir dos marcadores
+    // (opcionalmente só os de um rótulo), contando o relevo do marcador
+    std::vector<int> minimax(const std::vector<int>& relief, int width, int height, bool eightConnected,
+                             const SeedSet& markers, int onlyLabel = -1) {
+        std::vector<int> cost(relief.size(), UNREACHED);
+        std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>, std::greater<>> queue;
+        for (const Seed& seed : markers.getActiveSeeds()) {
+            if (onlyLabel != -1 && seed.label != onlyLabel) continue;
+            int v = seed.pixel.y * width + seed.pixel.x;
+            cost[v] = relief[v];
+            queue.push({cost[v], v});
+        }
+
+        int k = eightConnected ? 8 : 4;
+        while (!queue.empty()) {
+            auto [c, v] = queue.top();
+            queue.pop();
+            if (c != cost[v]) continue;
+            int x = v % width, y = v / width;
+            for (int d = 0; d < k; ++d) {
+                int nx = x + DX[d], ny = y + DY[d];
+                if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                int u = ny * width + nx;
+                int extended = std::max(c, relief[u]);
+                if (extended < cost[u]) {
+                    cost[u] = extended;
+                    queue.push({extended, u});
+                }
+            }
+        }
+        return cost;
+    }
+
+    Image randomImage(std::mt19937& rng, int width, int height) {
+        Image image(width, height);
+        for (int y = 0; y < height; ++y) {
+            for (int x = 0; x < width; ++x) image.setPixelValue(x, y, (rng() % 8) * 32);
+        }
+        return image;
+    }
+
+    SeedSet randomMarkers(std::mt19937& rng, const Image& image, int labels) {
+        SeedSet markers;
+        for (int label = 1; label <= labels; ++label) {
+            for (int i = 0, count = 1 + rng() % 2; i < count; ++i) {
+                Pixel p = image.getPixel(rng() % image.getWidth(), rng() % image.getHeight());
+                if (!markers.isSeed(p)) markers.addSeed(p, label);
+            }
+        }
+        return markers;
+    }
+}
+
+TEST(WatershedTransformTest, MatchesMinimaxDijkstra) {
+    std::mt19937 rng(46);
+    for (auto relief : {WatershedTransform::Relief::Image, WatershedTransform::Relief::Sobel,
+                        WatershedTransform::Relief::Morphological}) {
+        for (bool eight : {false, true}) {
+            for (int trial = 0; trial < 6; ++trial) {
+                int width = 3 + rng() % 20, height = 3 + rng() % 20, labelCount = 1 + rng() % 3;
+                Image image = randomImage(rng, width, height);
+                SeedSet markers = randomMarkers(rng, image, labelCount);
+
+                std::vector<int> values = reliefOf(image, relief);
+                std::vector<int> expected = minimax(values, width, height, eight, markers);
+                std::vector<std::vector<int>> perLabel;
+                for (int label = 1; label <= labelCount; ++label) {
+                    perLabel.push_back(minimax(values, width, height, eight, markers, label));
+                }
+
+                WatershedTransform::Result result = WatershedTransform(relief, false, eight).run(image, markers);
+                EXPECT_EQ(result.linePixels, 0u);
+                for (int v = 0; v < width * height; ++v) {
+                    ASSERT_EQ(result.costs[v], expected[v]) << width << "x" << height << ", pixel " << v;
+
+                    // O rótulo vem de um marcador que alcança v com custo ótimo;
+                    // sem empate entre rótulos, ele é único
+                    int label = result.labels[v];
+                    ASSERT_GE(label, 1);
+                    ASSERT_LE(label, labelCount);
+                    EXPECT_EQ(perLabel[label - 1][v], expected[v]) << "pixel " << v;
+                    for (int other = 1; other <= labelCount; ++other) {
+                        if (perLabel[other - 1][v] < perLabel[label - 1][v]) ADD_FAILURE() << "pixel " << v;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(WatershedTransformTest, WatershedLinesSeparateLabels) {
+    std::mt19937 rng(146);
+    for (bool eight : {false, true}) {
+        for (int trial = 0; trial < 8; ++trial) {
+            int width = 3 + rng() % 20, height = 3 + rng() % 20;
+            Image image = randomImage(rng, width, height);
+            SeedSet markers = randomMarkers(rng, image, 3);
+
+            WatershedTransform::Result result =
+                WatershedTransform(WatershedTransform::Relief::Image, true, eight).run(image, markers);
+
+            size_t lines = 0;
+            int k = eight ? 8 : 4;
+            for (int y = 0; y < height; ++y) {
+                for (int x = 0; x < width; ++x) {
+                    int label = result.labels[y * width + x];
+                    if (label == 0) lines++;
+                    if (label <= 0) continue;
+                    // Vizinhos rotulados de um pixel de região têm o mesmo rótulo
+                    // (exceto dois marcadores vizinhos, que não passam pela decisão)
+                    bool marker = markers.isSeed(image.getPixel(x, y));
+                    for (int d = 0; d < k; ++d) {
+                        int nx = x + DX[d], ny = y + DY[d];
+                        if (nx < 0 || nx >= width || ny < 0 || ny >= height) continue;
+                        int other = result.labels[ny * width + nx];
+                        if (other <= 0 || (marker && markers.isSeed(image.getPixel(nx, ny)))) continue;
+                        EXPECT_EQ(other, label) << "pixel (" << x << ", " << y << ")";
+                    }
+                }
+            }
+            EXPECT_EQ(result.linePixels, lines);
+            for (const Seed& seed : markers.getActiveSeeds()) {
+                EXPECT_EQ(result.labels[seed.pixel.y * width + seed.pixel.x], seed.label);
+            }
+        }
+    }
+}